@@ -0,0 +1,379 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file containers.cpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Benchmark sweeping every rflect container, layout, struct width and size.
+ *
+ * Benchmarks are named `<operation>/<container>/W<members>/<size>`, so a single
+ * operation or container can be selected with `--benchmark_filter`, e.g.
+ * `--benchmark_filter='^sort/dual_vector<soa>/W8/'`.
+ */
+
+#include <rflect/rflect.hpp>
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <format>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <vector>
+
+// clang-format off
+struct Wide2 {
+  DEFINE_PROXY(m00, m01);
+  float m00, m01;
+  friend bool operator==(Wide2 const&, Wide2 const&) = default;
+};
+
+struct Wide4 {
+  DEFINE_PROXY(m00, m01, m02, m03);
+  float m00, m01, m02, m03;
+  friend bool operator==(Wide4 const&, Wide4 const&) = default;
+};
+
+struct Wide8 {
+  DEFINE_PROXY(m00, m01, m02, m03, m04, m05, m06, m07);
+  float m00, m01, m02, m03, m04, m05, m06, m07;
+  friend bool operator==(Wide8 const&, Wide8 const&) = default;
+};
+
+struct Wide16 {
+  DEFINE_PROXY(m00, m01, m02, m03, m04, m05, m06, m07, m08, m09, m10, m11, m12, m13, m14, m15);
+  float m00, m01, m02, m03, m04, m05, m06, m07, m08, m09, m10, m11, m12, m13, m14, m15;
+  friend bool operator==(Wide16 const&, Wide16 const&) = default;
+};
+
+struct Wide32 {
+  DEFINE_PROXY(m00, m01, m02, m03, m04, m05, m06, m07, m08, m09, m10, m11, m12, m13, m14, m15,
+               m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31);
+  float m00, m01, m02, m03, m04, m05, m06, m07, m08, m09, m10, m11, m12, m13, m14, m15,
+        m16, m17, m18, m19, m20, m21, m22, m23, m24, m25, m26, m27, m28, m29, m30, m31;
+  friend bool operator==(Wide32 const&, Wide32 const&) = default;
+};
+// clang-format on
+
+namespace {
+
+constexpr auto time_unit           = benchmark::kMicrosecond;
+constexpr std::size_t memory_limit = std::size_t {1} << 30; // Bytes per container, larger runs are skipped
+constexpr std::size_t accesses     = std::size_t {1} << 16; // Random accesses per iteration
+constexpr std::array array_sizes   = {std::size_t {1} << 10, std::size_t {1} << 16, std::size_t {1} << 20};
+
+template<typename T>
+constexpr std::size_t width = nonstatic_data_members_of(^^T, std::meta::access_context::unchecked()).size();
+
+// *** Layout agnostic helpers ***
+
+template<typename T>
+T make_element(std::size_t const index) {
+  T value {};
+  template for (constexpr auto member:
+                nonstatic_data_members_of(^^T, std::meta::access_context::unchecked()) | rflect::to_static_array) {
+    value.[:member:] = static_cast<float>(index);
+  }
+  return value;
+}
+
+// multi_vector/multi_array are written column by column, the rest through operator[] (proxies or references)
+template<typename Container, typename T>
+void set_element(Container& container, std::size_t const index, T const& value) {
+  if constexpr (requires { container.template items<0>(); }) {
+    template for (constexpr auto member: std::views::iota(0UZ, width<T>)) {
+      container.template items<member>()[index] = value.[:rflect::nonstatic_data_member<T>(member):];
+    }
+  }
+  else {
+    container[index] = value;
+  }
+}
+
+template<typename Container>
+float key(Container& container, std::size_t const index) {
+  if constexpr (requires { container.template items<0>(); }) {
+    return container.template items<0>()[index];
+  }
+  else if constexpr (requires { container[index].m00(); }) {
+    return container[index].m00();
+  }
+  else {
+    return container[index].m00;
+  }
+}
+
+float key_of(auto const& element) {
+  if constexpr (requires { element.m00(); }) {
+    return element.m00();
+  }
+  else if constexpr (requires { element.m00; }) {
+    return element.m00;
+  }
+  else {
+    return std::get<0>(element);
+  }
+}
+
+template<typename Container>
+std::unique_ptr<Container> make_container(std::size_t const size) {
+  using value_type = typename Container::value_type;
+  auto container   = std::make_unique<Container>();
+  if constexpr (requires { container->resize(size); }) {
+    container->resize(size);
+  }
+  for (std::size_t i = 0; i < size; ++i) {
+    set_element(*container, i, make_element<value_type>(i));
+  }
+  return container;
+}
+
+template<typename Container>
+bool fits(benchmark::State& state, std::size_t const size) {
+  if (size * sizeof(typename Container::value_type) > memory_limit) {
+    state.SkipWithMessage("Container exceeds the memory limit");
+    return false;
+  }
+  return true;
+}
+
+// *** Operations ***
+
+template<typename Container>
+void push_back(benchmark::State& state) {
+  using value_type = typename Container::value_type;
+  auto const size  = static_cast<std::size_t>(state.range(0));
+  if (not fits<Container>(state, size)) {
+    return;
+  }
+
+  auto const element = make_element<value_type>(1);
+  for (auto _: state) {
+    Container container;
+    for (std::size_t i = 0; i < size; ++i) {
+      container.push_back(element);
+    }
+    benchmark::DoNotOptimize(container);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Container>
+void random_access(benchmark::State& state) {
+  auto const size = static_cast<std::size_t>(state.range(0));
+  if (not fits<Container>(state, size)) {
+    return;
+  }
+
+  auto container = make_container<Container>(size);
+  std::mt19937 engine {42}; // NOLINT
+  std::uniform_int_distribution<std::size_t> distribution {0, size - 1};
+  std::vector<std::size_t> indices(accesses);
+  std::ranges::generate(indices, [&] { return distribution(engine); });
+
+  for (auto _: state) {
+    float sum = 0.0F;
+    for (auto const index: indices) {
+      sum += key(*container, index);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(accesses));
+}
+
+template<typename Container>
+void iterate(benchmark::State& state) {
+  auto const size = static_cast<std::size_t>(state.range(0));
+  if (not fits<Container>(state, size)) {
+    return;
+  }
+
+  auto container = make_container<Container>(size);
+  for (auto _: state) {
+    float sum = 0.0F;
+    for (auto const& element: *container) {
+      sum += key_of(element);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Erases the middle element and pushes a new one back, so the size stays constant across iterations
+template<typename Container>
+void erase(benchmark::State& state) {
+  using value_type = typename Container::value_type;
+  auto const size  = static_cast<std::size_t>(state.range(0));
+  if (not fits<Container>(state, size)) {
+    return;
+  }
+
+  auto container     = make_container<Container>(size);
+  auto const element = make_element<value_type>(1);
+  for (auto _: state) {
+    container->erase(container->begin() + static_cast<std::ptrdiff_t>(size / 2));
+    container->push_back(element);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Element to element assignment, through proxies for dual containers
+template<typename Container>
+void assign(benchmark::State& state) {
+  auto const size = static_cast<std::size_t>(state.range(0));
+  if (not fits<Container>(state, size)) {
+    return;
+  }
+
+  auto container = make_container<Container>(size);
+  for (auto _: state) {
+    for (std::size_t i = 0; i < size / 2; ++i) {
+      (*container)[i] = (*container)[size - 1 - i];
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) / 2);
+}
+
+// Sorts by the first member (descending, a full reversal) computing the permutation and then gathering it
+template<typename Container>
+void sort(benchmark::State& state) {
+  auto const size = static_cast<std::size_t>(state.range(0));
+  if (not fits<Container>(state, 2 * size)) {
+    return;
+  }
+
+  auto source = make_container<Container>(size);
+  auto target = make_container<Container>(size);
+  std::vector<std::size_t> order(size);
+  for (auto _: state) {
+    std::iota(order.begin(), order.end(), 0UZ);
+    std::ranges::sort(order, std::ranges::greater {}, [&](std::size_t const index) { return key(*source, index); });
+    for (std::size_t i = 0; i < size; ++i) {
+      (*target)[i] = (*source)[order[i]];
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Same permutation as sort, applied by rflect::gather one member column at a time instead of element by element
+template<typename Container>
+void gather(benchmark::State& state) {
+  auto const size = static_cast<std::size_t>(state.range(0));
+  if (not fits<Container>(state, 2 * size)) {
+    return;
+  }
+
+  auto source = make_container<Container>(size);
+  auto target = make_container<Container>(size);
+  std::vector<std::size_t> order(size);
+  for (auto _: state) {
+    std::iota(order.begin(), order.end(), 0UZ);
+    std::ranges::sort(order, std::ranges::greater {}, [&](std::size_t const index) { return key(*source, index); });
+    rflect::gather(*source, order, *target);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Same descending order sorted in place by rflect::sort_by (radix sort of the key column, then a column wise permute)
+template<typename Container>
+void sort_by(benchmark::State& state) {
+  auto const size = static_cast<std::size_t>(state.range(0));
+  if (not fits<Container>(state, 2 * size)) {
+    return;
+  }
+
+  auto source = make_container<Container>(size);
+  auto target = make_container<Container>(size);
+  for (auto _: state) {
+    state.PauseTiming();
+    *target = *source;
+    state.ResumeTiming();
+    rflect::sort_by<&Container::value_type::m00>(*target, std::ranges::greater {});
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Container>
+void compare(benchmark::State& state) {
+  auto const size = static_cast<std::size_t>(state.range(0));
+  if (not fits<Container>(state, 2 * size)) {
+    return;
+  }
+
+  auto container1 = make_container<Container>(size);
+  auto container2 = make_container<Container>(size);
+  for (auto _: state) {
+    benchmark::DoNotOptimize(*container1 == *container2);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// *** Registration ***
+
+template<typename Container>
+void register_operations(std::string_view const container, auto const& configure) {
+  using value_type = typename Container::value_type;
+  auto const add   = [&](std::string_view const operation, void (*function)(benchmark::State&)) {
+    auto const name = std::format("{}/{}/W{}", operation, container, width<value_type>);
+    configure(benchmark::RegisterBenchmark(name.c_str(), function)->Unit(time_unit));
+  };
+
+  if constexpr (requires(Container& vec) { vec.push_back(std::declval<value_type>()); }) {
+    add("push_back", push_back<Container>);
+    add("erase", erase<Container>);
+  }
+  add("random_access", random_access<Container>);
+  add("iterate", iterate<Container>);
+  add("assign", assign<Container>);
+  add("sort", sort<Container>);
+  add("gather", gather<Container>);
+  add("sort_by", sort_by<Container>);
+  add("compare", compare<Container>);
+}
+
+template<typename T>
+void register_width() {
+  auto const vector_sizes = [](benchmark::internal::Benchmark* benchmark) {
+    benchmark->RangeMultiplier(8)->Range(1 << 10, 1 << 26);
+  };
+  register_operations<std::vector<T>>("std::vector", vector_sizes);
+  register_operations<rflect::multi_vector<T>>("multi_vector", vector_sizes);
+  register_operations<rflect::dual_vector<T, rflect::layout::aos>>("dual_vector<aos>", vector_sizes);
+  register_operations<rflect::dual_vector<T, rflect::layout::soa>>("dual_vector<soa>", vector_sizes);
+
+  template for (constexpr auto size: array_sizes) {
+    auto const array_size = [](benchmark::internal::Benchmark* benchmark) {
+      benchmark->Arg(static_cast<std::int64_t>(size));
+    };
+    register_operations<rflect::multi_array<T, size>>("multi_array", array_size);
+    register_operations<rflect::dual_array<T, size, rflect::layout::aos>>("dual_array<aos>", array_size);
+    register_operations<rflect::dual_array<T, size, rflect::layout::soa>>("dual_array<soa>", array_size);
+  }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  register_width<Wide2>();
+  register_width<Wide4>();
+  register_width<Wide8>();
+  register_width<Wide16>();
+  register_width<Wide32>();
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -57,6 +57,10 @@ if __name__ == "__main__":
         "../../build/Release/benchmark/fluid_simulator/reflected-aos",
         "../../build/Release/benchmark/fluid_simulator/non-reflected-soa",
         "../../build/Release/benchmark/fluid_simulator/reflected-soa",
+        "../../build/Release/benchmark/fluid_simulator/reflected-split",
+        "../../build/Release/benchmark/fluid_simulator/reflected-soa-flat",
+        "../../build/Release/benchmark/fluid_simulator/reflected-soa-arena",
+        "../../build/Release/benchmark/fluid_simulator/reflected-soa-small",
     ]
 
     num_runs = 5 # <--- Define aquí el número de ejecuciones por programa
@@ -99,6 +103,10 @@ if __name__ == "__main__":
             '#ffdfba', # Pastel Orange
             '#ffffba', # Pastel Yellow
             '#baffc9', # Pastel Green
+            '#bae1ff', # Pastel Blue
+            '#e0baff', # Pastel Purple
+            '#ffbaf2', # Pastel Pink
+            '#c9c9ff', # Pastel Lavender
             # Asegúrate de tener suficientes colores para el número de barras (ejecutables con tiempos válidos)
             # Si no, matplotlib reciclará colores o puedes añadir más a la lista
         ]
@@ -0,0 +1,52 @@
+import os
+import statistics
+import sys
+
+import matplotlib.pyplot as plt
+
+from plot_results import get_execution_time
+
+# --- Escalado de las variantes multihilo con el numero de hilos (SIM_THREADS) ---
+if __name__ == "__main__":
+    executables = [
+        "../../build/Release/benchmark/fluid_simulator/reflected-aos-mt",
+        "../../build/Release/benchmark/fluid_simulator/reflected-soa-mt",
+    ]
+    thread_counts = [1, 2, 4, 8, 16, 32, 64]
+    num_runs = 3 # Ejecuciones por programa y numero de hilos
+
+    plt.figure(figsize=(10, 6))
+    for exe_path in executables:
+        label = os.path.basename(exe_path)
+        measured_threads = []
+        average_times = []
+        for threads in thread_counts:
+            # Los ejecutables heredan el entorno, SIM_THREADS fija el tamaño del equipo de hilos del grid
+            os.environ["SIM_THREADS"] = str(threads)
+            times = [t for t in (get_execution_time(exe_path) for _ in range(num_runs)) if t is not None]
+            if times:
+                measured_threads.append(threads)
+                average_times.append(statistics.mean(times))
+                print(f"{label} con {threads} hilos: {average_times[-1]:.4f}s")
+
+        if average_times:
+            # Aceleracion respecto a la ejecucion con un solo hilo
+            speedups = [average_times[0] / t for t in average_times]
+            plt.plot(measured_threads, speedups, marker='o', label=label)
+        else:
+            print(f"No se obtuvieron tiempos válidos para {label}. Se omitirá en el gráfico.", file=sys.stderr)
+
+    plt.plot(thread_counts, thread_counts, linestyle='--', color='gray', label='ideal')
+    plt.xscale('log', base=2)
+    plt.yscale('log', base=2)
+    plt.xticks(thread_counts, [str(t) for t in thread_counts])
+    plt.xlabel("Threads")
+    plt.ylabel("Speedup over 1 thread")
+    plt.title(f"Fluid simulation scaling (Average of {num_runs} runs)")
+    plt.legend()
+    plt.grid(linestyle='--', alpha=0.7)
+    plt.tight_layout()
+
+    plt.savefig("results/scaling.png")
+    plt.close()
+    print("\nGráfico 'results/scaling.png' generado exitosamente.")
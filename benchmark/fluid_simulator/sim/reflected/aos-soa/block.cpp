@@ -210,6 +210,24 @@ void LimitsZ(auto particle, std::set<Limits> const& limits) {
  * @param block_index El índice del bloque actual en el vector de bloques.
  */
 void Block::calcDensities(FluidProperties const& properties, std::span<u32> adjacent, std::vector<Block>& blocks) {
+  accumulateDensities(properties, adjacent, blocks);
+  transformDensities(properties);
+}
+
+/**
+ * Acumula las contribuciones a la densidad entre las partículas del bloque y con las de los bloques adyacentes, sin
+ * transformarlas.
+ *
+ * Las contribuciones son simétricas, por lo que también se escriben las densidades de las partículas de los bloques
+ * adyacentes.
+ *
+ * @param properties Los parámetros de las partículas que incluyen el radio de suavizado.
+ * @param adjacent Un vector que almacena los índices de bloques adyacentes.
+ * @param blocks Un vector de bloques conteniendo partículas.
+ */
+void Block::accumulateDensities(
+    FluidProperties const& properties, std::span<u32> adjacent, std::vector<Block>& blocks
+) {
   for (size_t i = 0; i < particles.size(); ++i) {
     for (size_t j = i + 1; j < particles.size(); ++j) {
       incrementDensities(properties, particles[i], particles[j]);
@@ -219,7 +237,18 @@ void Block::calcDensities(FluidProperties const& properties, std::span<u32> adja
         incrementDensities(properties, particles[i], particle_j);
       }
     }
-    transformDensity(properties, particles[i]);
+  }
+}
+
+/**
+ * Transforma las densidades acumuladas de las partículas del bloque. Solo debe llamarse cuando todos los bloques
+ * vecinos han contribuido a ellas.
+ *
+ * @param properties Los parámetros de las partículas que incluyen el radio de suavizado.
+ */
+void Block::transformDensities(FluidProperties const& properties) {
+  for (auto const particle: particles) {
+    transformDensity(properties, particle);
   }
 }
 
@@ -4,20 +4,52 @@
 #include "utils/constants.hpp"
 #include <rflect/rflect.hpp>
 
+#include <memory_resource>
+#include <ranges>
 #include <set>
 #include <span>
 #include <vector>
 
 namespace sim {
 struct Block {
-#ifdef RFLECT_SOA
-  using container_type = rflect::dual_vector<Particle, rflect::layout::soa>;
+#if defined(RFLECT_ARENA)
+  // Las particulas se reservan en la arena del paso de simulacion en el que se crea el bloque
+  template<typename T>
+  using allocator = std::pmr::polymorphic_allocator<T>;
 #else
-  using container_type = rflect::dual_vector<Particle, rflect::layout::aos>;
+  template<typename T>
+  using allocator = std::allocator<T>;
+#endif
+
+#if defined(RFLECT_SMALL)
+  // La mayoria de bloques tienen pocas particulas, se guardan en columnas dentro del propio bloque y solo los bloques
+  // mas poblados reservan memoria
+  using container_type = rflect::dual_vector<Particle, rflect::layout::soa_small<16>, allocator>;
+#elif defined(RFLECT_SOA)
+  using container_type = rflect::dual_vector<Particle, rflect::layout::soa, allocator>;
+#elif defined(RFLECT_SPLIT)
+  // Miembros calientes en columnas (bucles de vecinos), id y hv (solo E/S y colisiones) en un array aparte
+  using hot_members    = rflect::layout::split<
+      &Particle::position, &Particle::velocity, &Particle::acceleration, &Particle::density>;
+  using container_type = rflect::dual_vector<Particle, hot_members, allocator>;
+#else
+  using container_type = rflect::dual_vector<Particle, rflect::layout::aos, allocator>;
+#endif
+
+#if defined(RFLECT_FLAT)
+  // El bloque es una vista sobre su tramo del vector plano de particulas del grid
+  using particles_type = std::ranges::subrange<container_type::iterator>;
+#else
+  using particles_type = container_type;
 #endif
 
   Block() = default;
 
+#if defined(RFLECT_ARENA)
+  explicit Block(std::pmr::memory_resource* const resource) : particles(resource) { }
+#endif
+
+#if !defined(RFLECT_FLAT)
   void addParticle(auto& particle) {
     particle.acceleration() = gravity;
     particle.density()      = 0;
@@ -30,8 +62,21 @@ struct Block {
     particles.push_back(particle);
   }
 
+  void addParticles(std::span<Particle> new_particles) {
+    for (auto& particle: new_particles) {
+      particle.acceleration = gravity;
+      particle.density      = 0;
+    }
+    particles.append_range(new_particles);
+  }
+#endif
+
   void calcDensities(FluidProperties const& properties, std::span<u32> adjacent, std::vector<Block>& blocks);
 
+  void accumulateDensities(FluidProperties const& properties, std::span<u32> adjacent, std::vector<Block>& blocks);
+
+  void transformDensities(FluidProperties const& properties);
+
   void calcAccelerations(FluidProperties const& properties, std::span<u32> adjacent, std::vector<Block>& blocks);
 
   void processCollisions(std::set<Limits>& limits);
@@ -40,6 +85,6 @@ struct Block {
 
   void moveParticles();
 
-  container_type particles;
+  particles_type particles;
 };
 } // namespace sim
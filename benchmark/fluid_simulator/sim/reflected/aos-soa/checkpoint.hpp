@@ -0,0 +1,173 @@
+#pragma once
+
+#include "block.hpp"
+#include "particle.hpp"
+#include "utils/error.hpp"
+#include "utils/primitive_types.hpp"
+
+#include <rflect/io.hpp>
+#include <rflect/rflect.hpp>
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stop_token>
+#include <string>
+#include <thread>
+
+namespace sim {
+
+/**
+ * Iteraciones entre checkpoints, tomadas de la variable de entorno SIM_CHECKPOINT. Si no esta definida, o vale 0, no
+ * se guardan checkpoints
+ */
+inline u32 checkpointInterval() {
+  if (char const* interval = std::getenv("SIM_CHECKPOINT"); interval != nullptr) {
+    return static_cast<u32>(std::stoul(interval));
+  }
+  return 0;
+}
+
+/**
+ * Escritor de checkpoints en segundo plano con doble buffer. `save` copia las columnas de las particulas a uno de los
+ * dos buffers y se lo entrega al hilo escritor, que lo guarda con `rflect::save_columns` mientras la simulacion sigue
+ * calculando; la simulacion solo espera si el buffer que le toca aun no se ha terminado de escribir. Cada checkpoint
+ * se escribe en un fichero temporal que despues se renombra, asi el fichero de checkpoint siempre esta completo.
+ */
+class Checkpoints {
+public:
+  using snapshot_type = rflect::dual_vector<Particle, rflect::layout::soa>;
+
+  explicit Checkpoints(std::filesystem::path path) : path_(std::move(path)) { }
+
+  Checkpoints(Checkpoints const&) = delete;
+
+  Checkpoints& operator=(Checkpoints const&) = delete;
+
+  /**
+   * Copia el estado de las particulas y encola su escritura
+   */
+  void save(std::span<Block const> const blocks) {
+    auto& buffer = buffers_[current_];
+    {
+      std::unique_lock lock(mutex_);
+      changed_.wait(lock, [&buffer] { return not buffer.pending; });
+    }
+
+    // El escritor no toca un buffer que no esta pendiente, la copia se hace sin el cerrojo
+    std::size_t count = 0;
+    for (auto const& block: blocks) {
+      count += block.particles.size();
+    }
+    buffer.particles.resize(count);
+    for (std::size_t offset = 0; auto const& block: blocks) {
+      copyParticles(block.particles, buffer.particles, offset);
+      offset += block.particles.size();
+    }
+
+    {
+      std::scoped_lock const lock(mutex_);
+      buffer.pending = true;
+    }
+    changed_.notify_all();
+    current_ ^= 1U;
+  }
+
+  /**
+   * Espera a que se escriban los checkpoints pendientes, devuelve el primer error de escritura
+   */
+  err::expected<void> finish() {
+    std::unique_lock lock(mutex_);
+    changed_.wait(lock, [this] { return std::ranges::none_of(buffers_, &Buffer::pending); });
+    if (error_) {
+      return err::unexpected(*error_);
+    }
+    return {};
+  }
+
+private:
+  struct Buffer {
+    snapshot_type particles;
+    bool pending = false;
+  };
+
+  /**
+   * Copia las particulas de un bloque a partir de la posicion `offset` del buffer. Los bloques con columnas (SoA) se
+   * copian columna a columna, recorriendo los miembros de `Particle` por reflexion; el resto particula a particula
+   */
+  static void copyParticles(auto const& particles, snapshot_type& snapshot, std::size_t const offset) {
+    if constexpr (requires { particles.spans(); }) {
+      auto const source = particles.spans();
+      auto const target = snapshot.spans();
+      using source_type = std::remove_const_t<decltype(source)>;
+      using target_type = std::remove_const_t<decltype(target)>;
+      template for (constexpr auto member:
+                    nonstatic_data_members_of(^^Particle, std::meta::access_context::unchecked()) |
+                        rflect::to_static_array) {
+        auto const column = source.[:rflect::nonstatic_data_member<source_type>(identifier_of(member)):];
+        std::ranges::copy(column, target.[:rflect::nonstatic_data_member<target_type>(identifier_of(member)):]
+                                      .subspan(offset)
+                                      .begin());
+      }
+    }
+    else {
+      for (auto index = offset; auto const particle: particles) {
+        snapshot[index++] = Particle {
+          .id           = particle.id(),
+          .position     = particle.position(),
+          .hv           = particle.hv(),
+          .velocity     = particle.velocity(),
+          .acceleration = particle.acceleration(),
+          .density      = particle.density(),
+        };
+      }
+    }
+  }
+
+  /**
+   * Bucle del hilo escritor, escribe los buffers en el mismo orden en el que se llenan. Al pedirle que pare termina de
+   * escribir los que esten pendientes
+   */
+  void write(std::stop_token const stop) {
+    u32 next = 0;
+    std::unique_lock lock(mutex_);
+    while (changed_.wait(lock, stop, [this, &next] { return buffers_[next].pending; })) {
+      auto& buffer = buffers_[next];
+      lock.unlock();
+
+      std::optional<std::string> error;
+      try {
+        auto const temporary = std::filesystem::path(path_) += ".tmp";
+        rflect::save_columns(buffer.particles, temporary);
+        std::filesystem::rename(temporary, path_);
+      }
+      catch (std::exception const& e) {
+        error = e.what();
+      }
+
+      lock.lock();
+      if (error and not error_) {
+        error_ = std::move(error);
+      }
+      buffer.pending = false;
+      next ^= 1U;
+      changed_.notify_all();
+    }
+  }
+
+  std::filesystem::path path_;
+  std::array<Buffer, 2> buffers_;
+  u32 current_ = 0;
+  std::optional<std::string> error_;
+  std::mutex mutex_;
+  std::condition_variable_any changed_;
+  std::jthread writer_ {[this](std::stop_token const stop) { write(stop); }}; // Ultimo miembro: se une el primero
+};
+
+} // namespace sim
@@ -4,8 +4,15 @@
 #include "simulator.hpp"
 #include "utils/error.hpp"
 
-#include <flat_map>
+#include <rflect/io.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
 #include <fstream>
+#include <generator>
+#include <ranges>
 #include <span>
 #include <vector>
 
@@ -13,28 +20,29 @@ namespace sim {
 
 namespace detail {
 
-inline err::expected<math::scalar> read_header(std::ifstream& file) {
+inline constexpr u32 chunk_particles  = 4096;    // Partículas decodificadas por tramo
+inline constexpr u32 window_particles = 1U << 16; // Partículas por pasada al escribir la salida
+
+/**
+ * Lee la cabecera directamente de los bytes del fichero proyectado, sin abrirlo una segunda vez
+ */
+inline err::expected<math::scalar> read_header(std::span<std::byte const> const bytes) {
   f32 particles_per_meter = 0.0F;
-  i32 np                  = 0.0F;
-  i32 file_length         = 0;
+  i32 np                  = 0;
 
-  try {
-    file.seekg(0, std::ifstream::end);
-    file_length = file.tellg();
-    file.seekg(0, std::ifstream::beg);
-    file.read(reinterpret_cast<char*>(&particles_per_meter), sizeof(particles_per_meter)); // NOLINT
-    file.read(reinterpret_cast<char*>(&np), sizeof(np)); // NOLINT
-  }
-  catch (std::ifstream::failure const& e) {
-    return err::unexpected("Exception raised reading header");
+  if (bytes.size() < header_size) {
+    return err::unexpected("File too short to hold a header");
   }
+  std::memcpy(&particles_per_meter, bytes.data(), sizeof(particles_per_meter));
+  std::memcpy(&np, bytes.data() + sizeof(particles_per_meter), sizeof(np));
 
   if (np <= 0) {
     std::cout << "Invalid number of particles\n";
     return err::unexpected(std::format("Invalid number of particles: {}", np));
   }
 
-  if (i32 const particles = (file_length - header_size) / sizeof(f32) / particle_components; particles != np) {
+  if (auto const particles = (bytes.size() - header_size) / sizeof(f32) / particle_components;
+      particles != static_cast<std::size_t>(np)) {
     return err::unexpected(
         std::format("Number of particles is not coherent with header\nExpected: {}\n Found: {}\n", np, particles)
     );
@@ -42,31 +50,30 @@ inline err::expected<math::scalar> read_header(std::ifstream& file) {
   return particles_per_meter;
 }
 
-inline auto read_particles(std::ifstream& file) -> std::vector<Particle> {
-  std::vector<Particle> particles;
-
-  try {
-    file.seekg(0, std::ifstream::end);
-    u64 const file_length = file.tellg();
-    file.seekg(0, std::ifstream::beg);
-
-    std::vector<f32> tmp((file_length - header_size) / sizeof(f32));
-    particles.reserve((file_length - header_size) / particle_components);
-    file.seekg(header_size, std::ifstream::beg);
-    file.read(reinterpret_cast<char*>(tmp.data()), file_length - header_size); // NOLINT
-    for (size_t i = 0; i < tmp.size(); i += particle_components) {
-      math::vec3 position = {tmp[i], tmp[i + 1], tmp[i + 2]};
-      math::vec3 vec_hv   = {tmp[i + 3], tmp[i + 4], tmp[i + 5]};
-      math::vec3 velocity = {tmp[i + 6], tmp[i + 7], tmp[i + 8]};
-      particles.emplace_back(i / particle_components, position, vec_hv, velocity);
+/**
+ * Decodifica las partículas del fichero proyectado en memoria (mmap) por tramos de `chunk_particles`, directamente
+ * sobre un contenedor del mismo tipo que el de los bloques (sus columnas en las versiones SoA). El tramo se reutiliza,
+ * así que la memoria extra no depende del tamaño del fichero.
+ */
+inline auto read_particles(rflect::mapped_file const& file) -> std::generator<Block::container_type&> {
+  auto const payload = file.bytes().subspan(header_size);
+  std::span const values {reinterpret_cast<f32 const*>(payload.data()), payload.size() / sizeof(f32)}; // NOLINT
+  auto const count = static_cast<u32>(values.size() / particle_components);
+
+  Block::container_type chunk;
+  for (u32 first = 0; first < count; first += chunk_particles) {
+    chunk.resize(std::min(chunk_particles, count - first));
+    for (u32 id = first; auto particle: chunk) {
+      auto const components   = values.subspan(std::size_t {id} * particle_components, particle_components);
+      particle.id()           = id++;
+      particle.position()     = {components[0], components[1], components[2]};
+      particle.hv()           = {components[3], components[4], components[5]};
+      particle.velocity()     = {components[6], components[7], components[8]};
+      particle.acceleration() = gravity;
+      particle.density()      = 0;
     }
+    co_yield chunk;
   }
-  catch (std::ifstream::failure const& e) {
-    particles.clear();
-    return particles;
-  }
-
-  return particles;
 }
 
 inline void write_header(std::ofstream& file, int np, math::scalar const ppm) {
@@ -75,64 +82,112 @@ inline void write_header(std::ofstream& file, int np, math::scalar const ppm) {
   file.write(reinterpret_cast<char*>(&np), sizeof(i32)); // NOLINT
 }
 
-inline void write_particles(std::ofstream& file, std::span<Particle const> const particles) {
-  std::array<f32, particle_components> tmp_values {};
-  for (auto const& particle: particles) {
-    tmp_values[0] = static_cast<f32>(particle.position.x);
-    tmp_values[1] = static_cast<f32>(particle.position.y);
-    tmp_values[2] = static_cast<f32>(particle.position.z);
-    tmp_values[3] = static_cast<f32>(particle.hv.x);
-    tmp_values[4] = static_cast<f32>(particle.hv.y);
-    tmp_values[5] = static_cast<f32>(particle.hv.z);
-    tmp_values[6] = static_cast<f32>(particle.velocity.x);
-    tmp_values[7] = static_cast<f32>(particle.velocity.y);
-    tmp_values[8] = static_cast<f32>(particle.velocity.z);
-    file.write(reinterpret_cast<char*>(tmp_values.data()), sizeof(float) * particle_components); // NOLINT
+/**
+ * Copia a la ventana los componentes de salida de las partículas del bloque cuyo id cae en `[first, first + ventana)`.
+ * Los bloques con columnas (SoA) se leen columna a columna, los AoS directamente del array y el resto partícula a
+ * partícula
+ */
+inline auto scatter_block(auto const& particles, std::size_t const first, std::span<f32> const window,
+                          std::size_t const count) -> err::expected<void> {
+  auto const scatter = [&](auto const& ids, auto const& positions, auto const& hvs,
+                           auto const& velocities) -> err::expected<void> {
+    auto const last = first + window.size() / particle_components;
+    for (auto const& [particle_id, position, hv, velocity]: std::views::zip(ids, positions, hvs, velocities)) {
+      std::size_t const id = particle_id;
+      if (id >= count) {
+        return err::unexpected(std::format("Particle id out of range: {}", id));
+      }
+      if (id < first or id >= last) {
+        continue;
+      }
+      auto* const out = window.data() + (id - first) * particle_components;
+      out[0]          = static_cast<f32>(position.x);
+      out[1]          = static_cast<f32>(position.y);
+      out[2]          = static_cast<f32>(position.z);
+      out[3]          = static_cast<f32>(hv.x);
+      out[4]          = static_cast<f32>(hv.y);
+      out[5]          = static_cast<f32>(hv.z);
+      out[6]          = static_cast<f32>(velocity.x);
+      out[7]          = static_cast<f32>(velocity.y);
+      out[8]          = static_cast<f32>(velocity.z);
+    }
+    return {};
+  };
+
+  if constexpr (requires { particles.spans(); }) {
+    auto const columns = particles.spans();
+    return scatter(columns.id, columns.position, columns.hv, columns.velocity);
+  }
+  else if constexpr (requires { particles.data(); }) {
+    std::span const elements {particles.data(), particles.size()};
+    return scatter(elements | std::views::transform(&Particle::id),
+                   elements | std::views::transform(&Particle::position),
+                   elements | std::views::transform(&Particle::hv),
+                   elements | std::views::transform(&Particle::velocity));
+  }
+  else {
+    return scatter(particles | std::views::transform([](auto const particle) { return particle.id(); }),
+                   particles | std::views::transform([](auto const particle) { return particle.position(); }),
+                   particles | std::views::transform([](auto const particle) { return particle.hv(); }),
+                   particles | std::views::transform([](auto const particle) { return particle.velocity(); }));
+  }
+}
+
+/**
+ * Escribe las partículas ordenadas por id sin pasar por un mapa ordenado ni por un buffer del tamaño de la salida: en
+ * cada pasada se reparten (scatter) sobre una ventana de `window_particles` partículas las que le corresponden por su
+ * id y se vuelca la ventana al fichero. Los ids son los índices asignados por `read_particles`.
+ */
+inline auto write_particles(std::ofstream& file, std::span<Block const> const blocks, std::size_t const count)
+    -> err::expected<void> {
+  std::vector<f32> window(std::min(count, std::size_t {window_particles}) * particle_components);
+  for (std::size_t first = 0; first < count; first += window_particles) {
+    auto const last   = std::min(count, first + window_particles);
+    auto const values = std::span(window).first((last - first) * particle_components);
+    for (auto const& block: blocks) {
+      if (auto const scattered = scatter_block(block.particles, first, values, count); not scattered) {
+        return scattered;
+      }
+    }
+    auto const* const bytes = reinterpret_cast<char const*>(values.data()); // NOLINT
+    file.write(bytes, static_cast<std::streamsize>(values.size_bytes()));
   }
+  return {};
 }
 } // namespace detail
 
 
 inline auto read_input_file(Arguments const& arguments) -> err::expected<Simulation> {
-  std::ifstream file {arguments.input_file, std::ios::binary};
-  auto const particles_per_meter = detail::read_header(file);
+  try {
+    rflect::mapped_file const input {arguments.input_file};
+    auto const particles_per_meter = detail::read_header(input.bytes());
+    if (not particles_per_meter) {
+      return err::unexpected(particles_per_meter.error().what());
+    }
 
-  if (not particles_per_meter) {
-    return err::unexpected(particles_per_meter.error().what());
+    return Simulation {
+      .arguments        = arguments,
+      .fluid_properties = fluid_properties(*particles_per_meter),
+      .grid             = Grid {detail::read_particles(input), mul_rad / *particles_per_meter},
+    };
   }
-
-  auto particles = detail::read_particles(file);
-  if (particles.empty()) {
-    return err::unexpected(particles_per_meter.error().what());
+  catch (std::system_error const& e) {
+    return err::unexpected(e.what());
   }
-
-  return Simulation {
-    .arguments        = arguments,
-    .fluid_properties = fluid_properties(*particles_per_meter),
-    .grid             = Grid {std::move(particles), mul_rad / *particles_per_meter},
-  };
 };
 
 constexpr auto write_output = [](Simulation&& sim) -> err::expected<Simulation> {
-  std::flat_map<u64, Particle> results;
-  std::ofstream file {sim.arguments.output_file, std::ios::binary};
-
+  std::size_t count = 0;
   for (auto const& block: sim.grid.getBlocks()) {
-    for (auto const particle : block.particles) {
-      results[particle.id()] = Particle {
-        .id = particle.id(),
-        .position = particle.position(),
-        .hv = particle.hv(),
-        .velocity = particle.velocity(),
-        .acceleration = particle.acceleration(),
-        .density = particle.density(),
-      };
-    }
+    count += block.particles.size();
   }
 
+  std::ofstream file {sim.arguments.output_file, std::ios::binary};
   try {
-    detail::write_header(file, static_cast<i32>(results.size()), sim.fluid_properties.particles_per_meter);
-    detail::write_particles(file, results.values());
+    detail::write_header(file, static_cast<i32>(count), sim.fluid_properties.particles_per_meter);
+    if (auto const written = detail::write_particles(file, sim.grid.getBlocks(), count); not written) {
+      return err::unexpected(written.error().what());
+    }
   }
   catch (std::ifstream::failure const& e) {
     return err::unexpected(e.what());
@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <iostream>
+#include <numeric>
 
 namespace sim {
 
@@ -11,15 +12,139 @@ namespace sim {
  * Una vez colocadas todas las particulas se intercambia el vector de bloques antiguo por el nuevo.
  */
 void Grid::repositioning() {
+#if defined(RFLECT_FLAT)
+  sortParticles();
+#else
+#if defined(RFLECT_ARENA)
+  std::vector<Block> aux = makeBlocks();
+#else
   std::vector<Block> aux(num_blocks_);
+#endif
+
+#if defined(RFLECT_MT)
+  // Primera pasada (paralela): bloque destino de cada particula
+  relocations_.resize(num_blocks_);
+  workers_->forEach(num_blocks_, [&](u32 const index) {
+    relocations_[index].clear();
+    for (auto particle: blocks_[index].particles) {
+      relocations_[index].emplace_back(getBlockIndex(particle.position()), 0);
+    }
+  });
+
+  // Segunda pasada: posicion de cada particula en su bloque destino, recorriendo los bloques en el mismo orden que la
+  // version secuencial para que las particulas queden ordenadas igual
+  std::vector<u32> counts(num_blocks_);
+  for (auto& relocations: relocations_) {
+    for (auto& [block, slot]: relocations) {
+      slot = counts[block]++;
+    }
+  }
+  workers_->forEach(num_blocks_, [&](u32 const index) { aux[index].particles.resize(counts[index]); });
+
+  // Tercera pasada (paralela): cada particula se copia a su hueco, ningun hueco se escribe dos veces
+  workers_->forEach(num_blocks_, [&](u32 const index) {
+    for (u32 i = 0; auto const particle: blocks_[index].particles) {
+      auto const [block, slot] = relocations_[index][i++];
+      auto target              = aux[block].particles[slot];
+      target                   = particle;
+      target.acceleration()    = gravity;
+      target.density()         = 0;
+    }
+  });
+#else
+  // Primera pasada: se cuenta cuantas particulas caen en cada bloque para reservar su memoria una unica vez
+  std::vector<u32> counts(num_blocks_);
+  for (auto& block: blocks_) {
+    for (auto particle: block.particles) {
+      ++counts[getBlockIndex(particle.position())];
+    }
+  }
+  for (u64 i = 0; i < num_blocks_; ++i) {
+    aux[i].particles.reserve(counts[i]);
+  }
 
   for (auto& block: blocks_) {
     for (auto particle: block.particles) {
       aux[getBlockIndex(particle.position())].addParticle(particle);
     }
   }
+#endif
   blocks_ = std::move(aux);
+#endif
+}
+
+#if defined(RFLECT_ARENA)
+/**
+ * Crea los bloques vacios del siguiente paso sobre la arena que no esta en uso. Los bloques que vivian en ella se
+ * crearon hace dos pasos y ya se han destruido, asi que se vacia de golpe en lugar de liberar cada bloque por separado.
+ * El buffer se dimensiona para todas las particulas mas el relleno de alineacion de cada columna de cada bloque, si se
+ * quedase corto la arena pediria mas memoria al recurso por defecto.
+ */
+std::vector<Block> Grid::makeBlocks() {
+  u64 particles = 0;
+  for (auto const& block: blocks_) {
+    particles += block.particles.size();
+  }
+  constexpr auto columns = nonstatic_data_members_of(^^Particle, std::meta::access_context::unchecked()).size();
+  auto const bytes       = particles * sizeof(Particle) + num_blocks_ * columns * alignof(std::max_align_t);
+
+  current_arena_ ^= 1;
+  auto& arena     = arenas_[current_arena_];
+  if (arena == nullptr or arena->buffer.size() < bytes) {
+    arena = std::make_unique<Arena>(bytes);
+  }
+  else {
+    arena->resource.release();
+  }
+
+  std::vector<Block> blocks;
+  blocks.reserve(num_blocks_);
+  for (u64 i = 0; i < num_blocks_; ++i) {
+    blocks.emplace_back(&arena->resource);
+  }
+  return blocks;
 }
+#endif
+
+#if defined(RFLECT_FLAT)
+/**
+ * Ordena el vector plano de particulas por bloque con una ordenacion por conteo. Se calcula el bloque de cada
+ * particula, la tabla de desplazamientos (primera particula de cada bloque) y la permutacion estable que agrupa las
+ * particulas, que rflect aplica columna a columna. Las particulas de un bloque conservan el orden relativo que tenian,
+ * igual que en la version con un contenedor por bloque.
+ */
+void Grid::sortParticles() {
+  auto const size = static_cast<u32>(particles_->size());
+
+  // Bloque de cada particula y numero de particulas de cada bloque
+  keys_.resize(size);
+  offsets_.assign(num_blocks_ + 1, 0);
+  for (u32 i = 0; auto const particle: *particles_) {
+    keys_[i] = getBlockIndex(particle.position());
+    ++offsets_[keys_[i] + 1];
+    ++i;
+  }
+  std::partial_sum(offsets_.begin(), offsets_.end(), offsets_.begin());
+
+  // order_[destino] = origen, las particulas de un mismo bloque se colocan en orden de aparicion
+  cursors_.assign(offsets_.begin(), offsets_.end() - 1);
+  order_.resize(size);
+  for (u32 i = 0; i < size; ++i) {
+    order_[cursors_[keys_[i]]++] = i;
+  }
+  rflect::permute(*particles_, order_);
+
+  for (auto particle: *particles_) {
+    particle.acceleration() = gravity;
+    particle.density()      = 0;
+  }
+
+  auto const first = particles_->begin();
+  for (u64 i = 0; i < num_blocks_; ++i) {
+    blocks_[i].particles = {first + offsets_[i], first + offsets_[i + 1]};
+  }
+}
+#endif
 
 /**
  * Funcion de calculo de aceleraciones, primero se calculan todas las densidades y posteriormente todas las
@@ -30,6 +155,22 @@ void Grid::calculateAccelerations(FluidProperties const& fluid_properties) {
   // a = 0
   // d = 0
 
+#if defined(RFLECT_MT)
+  // Los bloques de un mismo color se procesan en paralelo, las actualizaciones simetricas solo escriben en el propio
+  // bloque y en sus vecinos, que nunca son compartidos por otro bloque del mismo color
+  workers_->forEachGroup(colours_, [&](u32 const block_index) {
+    blocks_[block_index].accumulateDensities(fluid_properties, adjacent_blocks_[block_index], blocks_);
+  });
+
+  // Un bloque recibe contribuciones de vecinos de otros colores, por lo que las densidades se transforman al final
+  workers_->forEach(num_blocks_, [&](u32 const block_index) {
+    blocks_[block_index].transformDensities(fluid_properties);
+  });
+
+  workers_->forEachGroup(colours_, [&](u32 const block_index) {
+    blocks_[block_index].calcAccelerations(fluid_properties, adjacent_blocks_[block_index], blocks_);
+  });
+#else
   for (u64 block_index = 0; block_index < num_blocks_; ++block_index) {
     // Se calculan la densidad y aceleracion entre las particulas de un mismo bloque y bloques adjacentes
     blocks_[block_index].calcDensities(fluid_properties, adjacent_blocks_[block_index], blocks_);
@@ -39,6 +180,7 @@ void Grid::calculateAccelerations(FluidProperties const& fluid_properties) {
     // Se calcula la aceleracion entre las particulas de un mismo bloque y bloques adjacentes
     blocks_[block_index].calcAccelerations(fluid_properties, adjacent_blocks_[block_index], blocks_);
   }
+#endif
 }
 
 /**
@@ -56,9 +198,13 @@ void Grid::processCollisions() {
  * funcion de la aceleracion y densidad calculada en los pasos anteriores
  */
 void Grid::moveParticles() {
+#if defined(RFLECT_MT)
+  workers_->forEach(num_blocks_, [&](u32 const block_index) { blocks_[block_index].moveParticles(); });
+#else
   for (auto& block: blocks_) {
     block.moveParticles();
   }
+#endif
 }
 
 /**
@@ -117,6 +263,10 @@ void Grid::calculateAdjacentAndLimitBlocks(u32 const index) {
     static_cast<int>(index / (grid_size_.x * grid_size_.y))
   };
 
+#if defined(RFLECT_MT)
+  colours_[(block_pos.x % 3) + (3 * (block_pos.y % 3)) + (9 * (block_pos.z % 3))].push_back(index);
+#endif
+
   for (int i = -1; i <= 1; ++i) {
     for (int j = -1; j <= 1; ++j) {
       for (int k = -1; k <= 1; ++k) {
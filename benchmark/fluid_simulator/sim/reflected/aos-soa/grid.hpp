@@ -4,18 +4,42 @@
 #include "math/vector.hpp"
 #include "particle.hpp"
 
+#include <algorithm>
 #include <flat_map>
 #include <map>
+#include <memory>
+#include <numeric>
 #include <set>
 #include <vector>
 
 #include "utils/constants.hpp"
 
+#if defined(RFLECT_ARENA) and defined(RFLECT_MT)
+#error "La arena monotona no admite reservas concurrentes, RFLECT_ARENA y RFLECT_MT son incompatibles"
+#endif
+
+#if defined(RFLECT_ARENA)
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#endif
+
+#if defined(RFLECT_MT)
+#include "workers.hpp"
+
+#include <array>
+#include <utility>
+#endif
+
 namespace sim {
 
 class Grid {
 public:
-  explicit Grid(std::ranges::range auto&& particles, math::scalar const smoothing) :
+  /**
+   * Las particulas llegan por tramos, contenedores del mismo tipo que el de los bloques (ver `read_particles`), y cada
+   * tramo se agrupa por bloque y se inserta en bloque, sin reunir antes todas las particulas del fichero
+   */
+  explicit Grid(std::ranges::input_range auto&& chunks, math::scalar const smoothing) :
     grid_size_({
       static_cast<u32>(std::floor((top_limit.x - bottom_limit.x) / smoothing)), //
       static_cast<u32>(std::floor((top_limit.y - bottom_limit.y) / smoothing)), //
@@ -27,14 +51,40 @@ public:
       (top_limit.z - bottom_limit.z) / static_cast<math::scalar>(grid_size_.z),
     }),
     num_blocks_(grid_size_.x * grid_size_.y * grid_size_.z), blocks_(num_blocks_), adjacent_blocks_(num_blocks_) {
-    for (auto& particle: particles) {
-      u64 const block_index = getBlockIndex(particle.position);
-      blocks_[block_index].addParticle(particle); //
-    }
-
     for (u64 i = 0; i < num_blocks_; ++i) {
       calculateAdjacentAndLimitBlocks(i);
     }
+
+#if defined(RFLECT_FLAT)
+    for (auto& chunk: chunks) {
+      particles_->append_range(chunk);
+    }
+    sortParticles();
+#else
+    // Cada tramo se agrupa por bloque (orden estable, las particulas conservan el orden de entrada) y cada grupo se
+    // inserta de golpe en su bloque
+    std::vector<u32> keys;
+    std::vector<u32> order;
+    std::vector<Particle> bucket;
+    for (auto& chunk: chunks) {
+      keys.clear();
+      for (auto const particle: chunk) {
+        keys.push_back(getBlockIndex(particle.position()));
+      }
+      order.resize(keys.size());
+      std::iota(order.begin(), order.end(), 0U);
+      std::ranges::stable_sort(order, {}, [&keys](u32 const index) { return keys[index]; });
+
+      for (std::size_t first = 0; first < order.size();) {
+        auto const block = keys[order[first]];
+        bucket.clear();
+        for (; first < order.size() and keys[order[first]] == block; ++first) {
+          bucket.push_back(chunk[order[first]]);
+        }
+        blocks_[block].addParticles(bucket);
+      }
+    }
+#endif
   }
 
   void repositioning();
@@ -58,6 +108,14 @@ private:
 
   void addBlockToLimits(u32 index, math::Vec3<i32> const& neighbor_pos);
 
+#if defined(RFLECT_FLAT)
+  void sortParticles();
+#endif
+
+#if defined(RFLECT_ARENA)
+  [[nodiscard]] std::vector<Block> makeBlocks();
+#endif
+
   math::Vec3<u32> grid_size_; // n_x, n_y, n_z
   math::vec3 block_size_; // s_x, s_y, s_z
   u32 num_blocks_;
@@ -65,6 +123,39 @@ private:
   std::vector<Block> blocks_;
   std::vector<std::vector<u32>> adjacent_blocks_;
   std::map<u32, std::set<Limits>> grid_limits_;
+
+#if defined(RFLECT_FLAT)
+  // Todas las particulas en un unico contenedor ordenado por bloque, los bloques son vistas sobre su tramo. Se guarda
+  // en el heap para que las vistas sigan siendo validas cuando el grid se mueve
+  std::unique_ptr<Block::container_type> particles_ = std::make_unique<Block::container_type>();
+  std::vector<u32> offsets_; // Primera particula de cada bloque, num_blocks_ + 1 entradas
+  std::vector<u32> cursors_;
+  std::vector<u32> keys_; // Bloque de cada particula
+  std::vector<u32> order_; // Permutacion que agrupa las particulas por bloque
+#endif
+
+#if defined(RFLECT_ARENA)
+  // Buffer reservado una unica vez sobre el que una arena monotona reparte la memoria de los bloques de un paso
+  struct Arena {
+    explicit Arena(std::size_t const bytes) : buffer(bytes), resource(buffer.data(), buffer.size()) { }
+
+    std::vector<std::byte> buffer;
+    std::pmr::monotonic_buffer_resource resource;
+  };
+
+  // Dos arenas alternas: los bloques nuevos se crean en una mientras los actuales siguen vivos en la otra
+  std::array<std::unique_ptr<Arena>, 2> arenas_;
+  u32 current_arena_ = 0;
+#endif
+
+#if defined(RFLECT_MT)
+  // Colores de bloque (x % 3, y % 3, z % 3): dos bloques del mismo color no comparten ningun vecino
+  static constexpr u32 colour_count = 27;
+
+  std::array<std::vector<u32>, colour_count> colours_;
+  std::vector<std::vector<std::pair<u32, u32>>> relocations_; // (bloque destino, posicion) de cada particula
+  std::unique_ptr<Workers> workers_ = std::make_unique<Workers>(threadCount());
+#endif
 };
 
 } // namespace sim
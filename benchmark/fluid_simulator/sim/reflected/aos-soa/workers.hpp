@@ -0,0 +1,110 @@
+#pragma once
+
+#include "utils/primitive_types.hpp"
+
+#include <algorithm>
+#include <barrier>
+#include <cstdlib>
+#include <functional>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace sim {
+
+/**
+ * Numero de hilos de la simulacion, tomado de la variable de entorno SIM_THREADS o, si no esta definida, del numero de
+ * hilos hardware
+ */
+inline u32 threadCount() {
+  if (char const* threads = std::getenv("SIM_THREADS"); threads != nullptr) {
+    return static_cast<u32>(std::max(1UL, std::stoul(threads)));
+  }
+  return std::max(1U, std::thread::hardware_concurrency());
+}
+
+/**
+ * Equipo de hilos persistente. Los hilos se crean una unica vez y esperan en una barrera a que se les asigne trabajo,
+ * de forma que el coste de lanzar hilos no se paga en cada fase de cada iteracion. El hilo que llama participa como
+ * hilo 0.
+ */
+class Workers {
+public:
+  explicit Workers(u32 const threads) : threads_(threads), sync_(threads) {
+    team_.reserve(threads - 1);
+    for (u32 thread = 1; thread < threads; ++thread) {
+      team_.emplace_back([this, thread] { work(thread); });
+    }
+  }
+
+  Workers(Workers const&) = delete;
+
+  Workers& operator=(Workers const&) = delete;
+
+  ~Workers() {
+    stop_ = true;
+    sync_.arrive_and_wait();
+    team_.clear();
+  }
+
+  /**
+   * Ejecuta fn(i) para cada i en [0, count), cada hilo procesa un tramo contiguo
+   */
+  void forEach(u32 const count, std::function<void(u32)> const& fn) {
+    run([&](u32 const thread) {
+      for (u32 i = first(count, thread); i < first(count, thread + 1); ++i) {
+        fn(i);
+      }
+    });
+  }
+
+  /**
+   * Ejecuta fn(indice) para cada indice de cada grupo. Los grupos se procesan en orden y separados por una barrera,
+   * ningun hilo empieza un grupo hasta que todos han terminado el anterior
+   */
+  void forEachGroup(std::span<std::vector<u32> const> const groups, std::function<void(u32)> const& fn) {
+    run([&](u32 const thread) {
+      for (auto const& group: groups) {
+        auto const size = static_cast<u32>(group.size());
+        for (u32 i = first(size, thread); i < first(size, thread + 1); ++i) {
+          fn(group[i]);
+        }
+        sync_.arrive_and_wait();
+      }
+    });
+  }
+
+  [[nodiscard]] u32 size() const { return threads_; }
+
+private:
+  [[nodiscard]] u32 first(u32 const count, u32 const thread) const {
+    return static_cast<u32>(static_cast<u64>(count) * thread / threads_);
+  }
+
+  void run(std::function<void(u32)> const& job) {
+    job_ = &job;
+    sync_.arrive_and_wait(); // Arranque de la tarea
+    job(0);
+    sync_.arrive_and_wait(); // Todos los hilos han terminado
+  }
+
+  void work(u32 const thread) {
+    while (true) {
+      sync_.arrive_and_wait();
+      if (stop_) {
+        return;
+      }
+      (*job_)(thread);
+      sync_.arrive_and_wait();
+    }
+  }
+
+  u32 threads_;
+  std::barrier<> sync_;
+  std::function<void(u32)> const* job_ = nullptr;
+  bool stop_                           = false;
+  std::vector<std::jthread> team_;
+};
+
+} // namespace sim
@@ -3,6 +3,12 @@
 #include "grid.hpp"
 #include "utils/error.hpp"
 
+#if defined(RFLECT_CHECKPOINT)
+#include "checkpoint.hpp"
+
+#include <optional>
+#endif
+
 namespace sim {
 
 struct Arguments {
@@ -18,6 +24,15 @@ struct Simulation {
 };
 
 constexpr auto run_simulation = [](Simulation&& sim) -> err::expected<Simulation> {
+#if defined(RFLECT_CHECKPOINT)
+  // Cada SIM_CHECKPOINT iteraciones se guarda el estado en <output_file>.checkpoint desde un hilo aparte
+  auto const checkpoint_interval = checkpointInterval();
+  std::optional<Checkpoints> checkpoints;
+  if (checkpoint_interval > 0) {
+    checkpoints.emplace(sim.arguments.output_file + ".checkpoint");
+  }
+#endif
+
   for (int i = 0; i < sim.arguments.iterations; i++) {
     if (i > 0) {
       sim.grid.repositioning();
@@ -26,7 +41,21 @@ constexpr auto run_simulation = [](Simulation&& sim) -> err::expected<Simulation
     sim.grid.processCollisions();
     sim.grid.moveParticles();
     sim.grid.processLimits();
+
+#if defined(RFLECT_CHECKPOINT)
+    if (checkpoints and static_cast<u32>(i + 1) % checkpoint_interval == 0) {
+      checkpoints->save(sim.grid.getBlocks());
+    }
+#endif
+  }
+
+#if defined(RFLECT_CHECKPOINT)
+  if (checkpoints) {
+    if (auto const written = checkpoints->finish(); not written) {
+      return err::unexpected(written.error().what());
+    }
   }
+#endif
   return std::move(sim);
 };
 
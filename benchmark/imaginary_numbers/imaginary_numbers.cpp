@@ -77,6 +77,22 @@ static void benchmark_rflect(benchmark::State& state) {
   }
 }
 
+template<rflect::memory_layout Layout>
+static void benchmark_rflect_columns(benchmark::State& state) {
+  constexpr auto real = std::define_static_string("real");
+  auto n = static_cast<std::size_t>(state.range(0));
+    rflect::dual_vector<Complex, Layout> a(n);
+    rflect::dual_vector<Complex, Layout> b(n);
+    float v = 0.0F;
+    for (auto [x,y] : std::views::zip(a, b)) {
+      x.real() = v++;
+      y.real() = v;
+    }
+  for (auto _ : state) {
+    rflect::transform_spans([](auto& x, auto const& y) { x *= y; }, a.template items<real>(), b.template items<real>());
+  }
+}
+
 constexpr auto time_unit = benchmark::kMicrosecond;
 
 // clang-format off
@@ -96,6 +112,14 @@ BENCHMARK_TEMPLATE(benchmark_rflect, rflect::layout::soa)
     ->Unit(time_unit)
     ->Name("RflectSoa");
 
+BENCHMARK_TEMPLATE(benchmark_rflect_columns, rflect::layout::soa)
+    ->Arg(1<<10)
+    ->Arg(1<<14)
+    ->Arg(1<<18)
+    ->Arg(1<<22)
+    ->Unit(time_unit)
+    ->Name("RflectSoaColumns");
+
 BENCHMARK(benchmark_aos)
     ->Arg(1<<10)
     ->Arg(1<<14)
@@ -100,6 +100,7 @@ def plot_comparison_bars(series_dict, title, output_path):
         ('RflectAos', 'Rflect AoS'),
         ('benchmark_soa', 'SoA'),
         ('RflectSoa', 'Rflect SoA'),
+        ('RflectSoaColumns', 'Rflect SoA columns'),
     ]
     plt.figure(figsize=(14, 8)) # Aumentamos ligeramente el tamaño para acomodar el texto
 
@@ -110,11 +111,11 @@ def plot_comparison_bars(series_dict, title, output_path):
             all_sizes.update(data.keys())
     all_sizes = sorted(all_sizes)
 
-    width = 0.2
+    width = 0.16
     x = range(len(all_sizes))
 
-    offsets = [-1.5, -0.5, 0.5, 1.5]
-    colors = ['#8DA0CB', '#A6D854', '#E15759', '#76B7B2']
+    offsets = [-2, -1, 0, 1, 2]
+    colors = ['#8DA0CB', '#A6D854', '#E15759', '#76B7B2', '#F28E2B']
 
     for (base, label), offset, color in zip(label_map, offsets, colors):
         data = series_dict.get(base)
@@ -25,18 +25,85 @@ struct is_layout : std::false_type {};
 template<>
 struct is_layout<layout::soa> : std::true_type {};
 
+template<>
+struct is_layout<layout::soa_flat> : std::true_type {};
+
+template<>
+struct is_layout<layout::packed_soa> : std::true_type {};
+
+template<std::size_t Align>
+struct is_layout<layout::aligned_soa<Align>> : std::true_type {};
+
+template<std::size_t N>
+struct is_layout<layout::soa_small<N>> : std::true_type {};
+
 template<>
 struct is_layout<layout::aos> : std::true_type {};
 
+template<std::size_t Lanes>
+struct is_layout<layout::aosoa<Lanes>> : std::true_type {};
+
+template<auto... HotMembers>
+struct is_layout<layout::split<HotMembers...>> : std::true_type {};
+
+template<typename T>
+struct is_soa : std::false_type {};
+
+template<>
+struct is_soa<layout::soa> : std::true_type {};
+
+template<>
+struct is_soa<layout::soa_flat> : std::true_type {};
+
+template<>
+struct is_soa<layout::packed_soa> : std::true_type {};
+
+template<std::size_t Align>
+struct is_soa<layout::aligned_soa<Align>> : std::true_type {};
+
+template<std::size_t N>
+struct is_soa<layout::soa_small<N>> : std::true_type {};
+
+template<typename T>
+struct is_aosoa : std::false_type {};
+
+template<std::size_t Lanes>
+struct is_aosoa<layout::aosoa<Lanes>> : std::true_type {};
+
+template<typename T>
+struct is_split : std::false_type {};
+
+template<auto... HotMembers>
+struct is_split<layout::split<HotMembers...>> : std::true_type {};
+
+/**
+ * Containers exposing their member columns (SoA) as a structure of spans through `spans()`
+ */
+template<typename Container>
+concept columnar = requires(Container& container) { container.spans(); };
+
 }
 
 template<typename T>
 concept memory_layout = detail::is_layout<T>::value;
 
 template<typename T>
-concept soa_layout = std::same_as<T, layout::soa> or std::same_as<typename T::memory_layout, layout::soa>;
+concept soa_layout = detail::is_soa<T>::value or detail::is_soa<typename T::memory_layout>::value;
 
 template<typename T>
 concept aos_layout = std::same_as<T, layout::aos> or std::same_as<typename T::memory_layout, layout::aos>;
 
+template<typename T>
+concept aosoa_layout = detail::is_aosoa<T>::value or detail::is_aosoa<typename T::memory_layout>::value;
+
+template<typename T>
+concept split_layout = detail::is_split<T>::value or detail::is_split<typename T::memory_layout>::value;
+
+/**
+ * Layouts scattering the members of an element across several arrays, their containers gather elements into copies
+ * (`at`), scatter them back (`set`) and give access to a single member (`item`)
+ */
+template<typename T>
+concept gather_layout = aosoa_layout<T> or split_layout<T>;
+
 }
@@ -14,7 +14,19 @@
 #include <rflect/containers/dual_array.hpp>
 #include <rflect/containers/multi_array.hpp>
 #include <rflect/containers/dual_vector.hpp>
+#include <rflect/containers/aligned_allocator.hpp>
 #include <rflect/containers/multi_vector.hpp>
+#include <rflect/containers/flat_multi_vector.hpp>
+#include <rflect/containers/packed_multi_vector.hpp>
+#include <rflect/containers/projection.hpp>
+#include <rflect/containers/slot_map.hpp>
+#include <rflect/containers/small_multi_vector.hpp>
+#include <rflect/containers/soa_ring.hpp>
+#include <rflect/containers/static_multi_vector.hpp>
+#include <rflect/containers/tiled_array.hpp>
+#include <rflect/containers/tiled_vector.hpp>
+#include <rflect/containers/split_array.hpp>
+#include <rflect/containers/split_vector.hpp>
 #include <rflect/containers/memory_layout.hpp>
 #include <rflect/containers/iterator.hpp>
 #include <rflect/containers/proxy.hpp>
@@ -0,0 +1,123 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file aligned_allocator.hpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Over aligned, padded allocator adaptor
+ *
+ * Allocator adaptor used for the columns of aligned structure of arrays
+ * containers: every allocation starts on an `Align` boundary and spans a
+ * whole number of `Align` sized blocks
+ */
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <memory>
+
+namespace rflect {
+
+namespace detail {
+
+/**
+ * Allocation unit of aligned columns. Allocating blocks instead of elements makes the upstream allocator provide the
+ * alignment and rounds every allocation up to a multiple of `Align` bytes
+ */
+template<std::size_t Align>
+struct alignas(Align) aligned_block {
+  std::byte bytes[Align];
+};
+
+} // namespace detail
+
+/**
+ * @brief Allocator adaptor returning storage aligned to `Align` bytes and padded to a multiple of `Align` bytes.
+ *
+ * Memory comes from `Alloc` rebound to `Align` sized blocks, so stateful upstream allocators (e.g.
+ * `std::pmr::polymorphic_allocator`) keep working. With `Align` set to the cache line or SIMD register width, a
+ * column of `n` elements can be processed with aligned full width loads up to `n` rounded up to the register width:
+ * the padding past the last element belongs to the allocation, although it holds no elements.
+ *
+ * @tparam T Element type
+ * @tparam Alloc Upstream allocator template
+ * @tparam Align Alignment and padding granularity in bytes, a power of two not smaller than `alignof(T)`
+ */
+template<typename T, template<typename> class Alloc, std::size_t Align>
+class aligned_allocator {
+  static_assert(std::has_single_bit(Align), "Alignment must be a power of two");
+  static_assert(Align >= alignof(T), "Alignment must not be smaller than the alignment of the element type");
+
+public:
+  using value_type      = T;
+  using block_type      = detail::aligned_block<Align>;
+  using upstream_type   = Alloc<block_type>;
+  using upstream_traits = std::allocator_traits<upstream_type>;
+
+  using propagate_on_container_copy_assignment = typename upstream_traits::propagate_on_container_copy_assignment;
+  using propagate_on_container_move_assignment = typename upstream_traits::propagate_on_container_move_assignment;
+  using propagate_on_container_swap            = typename upstream_traits::propagate_on_container_swap;
+  using is_always_equal                        = typename upstream_traits::is_always_equal;
+
+  template<typename U>
+  struct rebind {
+    using other = aligned_allocator<U, Alloc, Align>;
+  };
+
+  static constexpr std::size_t alignment = Align;
+
+  constexpr aligned_allocator() = default;
+
+  template<typename U>
+  constexpr explicit aligned_allocator(Alloc<U> const& upstream) noexcept : upstream_(upstream) { }
+
+  template<typename U>
+  constexpr aligned_allocator(aligned_allocator<U, Alloc, Align> const& other) noexcept : // NOLINT
+    upstream_(other.upstream()) { }
+
+  /**
+   * Upstream allocator rebound to `U`, so containers can hand back the allocator they were given
+   */
+  template<typename U>
+  constexpr explicit operator Alloc<U>() const noexcept {
+    return Alloc<U>(upstream_);
+  }
+
+  [[nodiscard]] T* allocate(std::size_t const count) {
+    return reinterpret_cast<T*>(upstream_traits::allocate(upstream_, blocks_for(count))); // NOLINT
+  }
+
+  void deallocate(T* const pointer, std::size_t const count) noexcept {
+    upstream_traits::deallocate(upstream_, reinterpret_cast<block_type*>(pointer), blocks_for(count)); // NOLINT
+  }
+
+  [[nodiscard]] constexpr aligned_allocator select_on_container_copy_construction() const {
+    return aligned_allocator(upstream_traits::select_on_container_copy_construction(upstream_));
+  }
+
+  [[nodiscard]] constexpr upstream_type const& upstream() const noexcept { return upstream_; }
+
+  /**
+   * Bytes actually allocated for `count` elements, the usable extent of a column of that capacity
+   */
+  [[nodiscard]] static constexpr std::size_t padded_bytes(std::size_t const count) noexcept {
+    return blocks_for(count) * Align;
+  }
+
+  template<typename U>
+  friend constexpr bool operator==(aligned_allocator const& lhs, aligned_allocator<U, Alloc, Align> const& rhs) {
+    return lhs.upstream_ == rhs.upstream();
+  }
+
+private:
+  static constexpr std::size_t blocks_for(std::size_t const count) noexcept {
+    return (count * sizeof(T) + Align - 1) / Align;
+  }
+
+  [[no_unique_address]] upstream_type upstream_ {};
+};
+
+} // namespace rflect
@@ -21,8 +21,54 @@ constexpr bool operator==(multi_array<T, N> const& array1, multi_array<T, N> con
   return sz == array2.size() && std::ranges::equal(array1, array2);
 }
 
+template<typename T, template<typename> class Alloc, std::size_t Align>
+constexpr bool operator==(multi_vector<T, Alloc, Align> const& vec1, multi_vector<T, Alloc, Align> const& vec2) {
+  auto const sz = vec1.size();
+  return sz == vec2.size() && std::ranges::equal(vec1, vec2);
+}
+
 template<typename T, template<typename> class Alloc>
-constexpr bool operator==(multi_vector<T, Alloc> const& vec1, multi_vector<T, Alloc> const& vec2) {
+constexpr bool operator==(flat_multi_vector<T, Alloc> const& vec1, flat_multi_vector<T, Alloc> const& vec2) {
+  auto const sz = vec1.size();
+  return sz == vec2.size() && std::ranges::equal(vec1, vec2);
+}
+
+template<typename T, template<typename> class Alloc>
+constexpr bool operator==(packed_multi_vector<T, Alloc> const& vec1, packed_multi_vector<T, Alloc> const& vec2) {
+  auto const sz = vec1.size();
+  return sz == vec2.size() && std::ranges::equal(vec1, vec2);
+}
+
+template<typename T, std::size_t N>
+constexpr bool operator==(static_multi_vector<T, N> const& vec1, static_multi_vector<T, N> const& vec2) {
+  auto const sz = vec1.size();
+  return sz == vec2.size() && std::ranges::equal(vec1, vec2);
+}
+
+template<typename T, std::size_t N, template<typename> class Alloc>
+constexpr bool operator==(small_multi_vector<T, N, Alloc> const& vec1, small_multi_vector<T, N, Alloc> const& vec2) {
+  auto const sz = vec1.size();
+  return sz == vec2.size() && std::ranges::equal(vec1, vec2);
+}
+
+template<typename T, std::size_t N, std::size_t Lanes>
+constexpr bool operator==(tiled_array<T, N, Lanes> const& array1, tiled_array<T, N, Lanes> const& array2) {
+  return std::ranges::equal(array1, array2);
+}
+
+template<typename T, std::size_t Lanes, template<typename> class Alloc>
+constexpr bool operator==(tiled_vector<T, Lanes, Alloc> const& vec1, tiled_vector<T, Lanes, Alloc> const& vec2) {
+  auto const sz = vec1.size();
+  return sz == vec2.size() && std::ranges::equal(vec1, vec2);
+}
+
+template<typename T, std::size_t N, auto... Hot>
+constexpr bool operator==(split_array<T, N, Hot...> const& array1, split_array<T, N, Hot...> const& array2) {
+  return std::ranges::equal(array1, array2);
+}
+
+template<typename T, template<typename> class Alloc, auto... Hot>
+constexpr bool operator==(split_vector<T, Alloc, Hot...> const& vec1, split_vector<T, Alloc, Hot...> const& vec2) {
   auto const sz = vec1.size();
   return sz == vec2.size() && std::ranges::equal(vec1, vec2);
 }
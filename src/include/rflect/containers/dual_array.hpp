@@ -42,7 +42,7 @@ public:
   constexpr dual_array() = default;
 
   constexpr dual_array(std::initializer_list<value_type> init)
-    requires(soa_layout<Layout>)
+    requires(soa_layout<Layout> or gather_layout<Layout>)
     : data_(init) { }
 
   constexpr dual_array(std::initializer_list<value_type> init)
@@ -69,6 +69,25 @@ public:
 
   [[nodiscard]] constexpr const_view_type back() const { return {data_, size() - 1}; }
 
+  /**
+   * Contiguous span over the column of member `name`. Only available for structure of arrays layouts (and the hot
+   * members of split layouts)
+   */
+  template<char const* name, typename Self>
+    requires(soa_layout<Layout> or split_layout<Layout>)
+  constexpr auto items(this Self& self) {
+    return std::span(self.data_.template items<name>());
+  }
+
+  /**
+   * Structure of spans over every column, see `items`
+   */
+  template<typename Self>
+    requires(soa_layout<Layout>)
+  constexpr auto spans(this Self& self) {
+    return self.data_.spans();
+  }
+
   // ********* Iterators *********
 
   constexpr iterator begin() noexcept { return {data_, 0}; }
@@ -89,7 +108,13 @@ public:
 
   [[nodiscard]] constexpr size_type max_size() const noexcept { return data_.max_size(); }
 
-  [[nodiscard]] constexpr size_type empty() const noexcept { return data_.empty(); }
+  [[nodiscard]] constexpr bool empty() const noexcept { return data_.empty(); }
+
+  // ********** Operators **********
+
+  friend constexpr bool operator==(dual_array const& array1, dual_array const& array2) {
+    return array1.data_ == array2.data_;
+  }
 
 private:
   underlying_container data_ {};
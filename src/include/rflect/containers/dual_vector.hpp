@@ -20,6 +20,8 @@
 #include <rflect/concepts/proxy_concepts.hpp>
 #include <rflect/containers/iterator.hpp>
 
+#include <memory_resource>
+
 namespace rflect {
 
 template<has_proxy T, memory_layout Layout = layout::aos, template<typename> class Alloc = std::allocator>
@@ -29,6 +31,7 @@ public:
    *          Member types          *
    **********************************/
   using value_type           = T;
+  using allocator_type       = Alloc<T>;
   using underlying_container = typename Layout::template vector<T, Alloc>;
   using view_type            = typename T::template proxy_type<dual_vector>;
   using const_view_type      = typename T::template proxy_type<dual_vector const>;
@@ -50,6 +53,18 @@ public:
 
   constexpr explicit dual_vector(size_type size) : data_(size) { }
 
+  /**
+   * Forwards `alloc` to the underlying container, which rebinds it to every column in structure of arrays layouts
+   */
+  constexpr explicit dual_vector(allocator_type const& alloc) : data_(alloc) { }
+
+  /**
+   * Allocator of the underlying container, rebound to `value_type`
+   */
+  [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+    return allocator_type(data_.get_allocator());
+  }
+
   // ********* Element access *********
 
   constexpr view_type at(size_type const index) { return {data_, index}; }
@@ -64,6 +79,46 @@ public:
 
   constexpr view_type back() { return {data_, size() - 1}; }
 
+  /**
+   * Contiguous span over the column of member `name`. Only available for structure of arrays layouts (and the hot
+   * members of split layouts), where it lets algorithms split the container by index (see `proxy_iterator::index`)
+   * without going through proxies
+   */
+  template<char const* name, typename Self>
+    requires(soa_layout<Layout> or split_layout<Layout>)
+  constexpr auto items(this Self& self) {
+    return std::span(self.data_.template items<name>());
+  }
+
+  /**
+   * Column of member `name` extended up to the end of its padding, see `multi_vector::padded_items`. Only available for
+   * `layout::aligned_soa`
+   */
+  template<char const* name, typename Self>
+    requires(requires(underlying_container& data) { data.template padded_items<name>(); })
+  constexpr auto padded_items(this Self& self) {
+    return self.data_.template padded_items<name>();
+  }
+
+  /**
+   * Structure of spans over every column, see `items`
+   */
+  template<typename Self>
+    requires(soa_layout<Layout>)
+  constexpr auto spans(this Self& self) {
+    return self.data_.spans();
+  }
+
+  /**
+   * Pointer to the contiguous array of elements. Only available for the array of structures layout, see `spans` for
+   * structure of arrays layouts
+   */
+  template<typename Self>
+    requires(aos_layout<Layout>)
+  constexpr auto data(this Self& self) noexcept {
+    return self.data_.data();
+  }
+
   // ********* Iterators *********
 
   constexpr iterator begin() noexcept { return {data_, 0}; }
@@ -80,13 +135,15 @@ public:
 
   // ********* Capacity *********
 
-  [[nodiscard]] constexpr size_type empty() const noexcept { return data_.size(); }
+  [[nodiscard]] constexpr bool empty() const noexcept { return data_.empty(); }
 
   [[nodiscard]] constexpr size_type size() const noexcept { return data_.size(); }
 
-  [[nodiscard]] constexpr size_type max_size() const noexcept { return data_.size(); }
+  [[nodiscard]] constexpr size_type max_size() const noexcept { return data_.max_size(); }
+
+  [[nodiscard]] constexpr size_type capacity() const noexcept { return data_.capacity(); }
 
-  [[nodiscard]] constexpr size_type capacity() const noexcept { return data_.size(); }
+  constexpr void reserve(size_type const new_capacity) { data_.reserve(new_capacity); }
 
   // ********* Modifiers *********
 
@@ -108,6 +165,25 @@ public:
     return iterator;
   }
 
+  /**
+   * Appends a range of `value_type`. Structure of arrays layouts copy it column by column
+   */
+  template<std::ranges::forward_range R>
+    requires(std::convertible_to<std::ranges::range_reference_t<R>, value_type const&>)
+  constexpr void append_range(R&& range) {
+    data_.append_range(std::forward<R>(range));
+  }
+
+  template<std::forward_iterator It>
+    requires(std::convertible_to<std::iter_reference_t<It>, value_type const&>)
+  constexpr iterator insert(const_iterator const pos, It const first, It const last) {
+    difference_type const diff = pos - cbegin();
+    data_.insert(data_.begin() + diff, first, last);
+    return begin() + diff;
+  }
+
+  constexpr void resize(size_type const new_size) { data_.resize(new_size); }
+
   // ********** Operators **********
 
   friend constexpr bool operator==(dual_vector const& vec1, dual_vector const& vec2) {
@@ -124,4 +200,11 @@ private:
 template<has_proxy T>
 dual_vector(std::initializer_list<T> init) -> dual_vector<T>;
 
+namespace pmr {
+
+template<has_proxy T, memory_layout Layout = layout::aos>
+using dual_vector = rflect::dual_vector<T, Layout, std::pmr::polymorphic_allocator>;
+
+} // namespace pmr
+
 } // namespace rflect
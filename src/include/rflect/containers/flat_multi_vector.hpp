@@ -0,0 +1,258 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file flat_multi_vector.hpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Multi vector with flattened class type members
+ *
+ * Structure of arrays container storing one column per flattened member,
+ * so a `vec3` member takes three scalar columns instead of one column of
+ * `vec3`
+ */
+
+#pragma once
+
+#include <rflect/containers/multi_vector.hpp>
+#include <rflect/converters/flatten.hpp>
+#include <rflect/converters/struct_to_soa.hpp>
+#include <rflect/introspection/struct.hpp>
+
+#include <ranges>
+#include <utility>
+
+namespace rflect {
+
+/**
+ * @brief Structure of arrays container splitting class type members into one column per scalar.
+ *
+ * A `multi_vector` stores a `vec3 position` member as a vector of `vec3`, which is still an array of structures for
+ * x, y and z. This container stores a `multi_vector<flat_struct<T>>` instead, so `position_x`, `position_y` and
+ * `position_z` are separate columns and a loop over one coordinate of many elements is contiguous (see `flat_struct`
+ * for which members are split).
+ *
+ * Columns are addressed two ways. Indices refer to the physical, flattened columns: `items<I>()`, `at()` (a tuple of
+ * references with one element per flattened member) and `spans()` (a `struct_of_spans<flat_struct<T>>`, e.g.
+ * `spans().position_x`). Names refer to the members of `T`: `items<"id">()` is the `id` column and
+ * `items<"position">()` is a view over the three position columns whose elements are `member_reference<vec3>`, which
+ * is what proxies of a `dual_vector<T, layout::soa_flat>` return for `position()`.
+ *
+ * @tparam T Aggregate type to be converted
+ * @tparam Alloc Allocator type for vectors
+ */
+template<typename T, template<typename> class Alloc = std::allocator>
+  requires(std::is_aggregate_v<T>)
+class flat_multi_vector {
+public:
+  /**********************************
+   *          Member types          *
+   **********************************/
+  using value_type           = T;
+  using allocator_type       = Alloc<T>;
+  using flat_type            = flat_struct<T>;
+  using columns_type         = multi_vector<flat_type, Alloc>;
+  using underlying_container = typename columns_type::underlying_container;
+  using iterator             = typename columns_type::iterator;
+  using const_iterator       = typename columns_type::const_iterator;
+  using size_type            = std::size_t;
+
+  /**
+   * @brief Columns of a flattened member of `T`, seen as a range of `member_reference<Member>`
+   *
+   * @tparam Member Type of the member
+   * @tparam First Index of its first flattened column
+   * @tparam Columns `columns_type`, const qualified for read only access
+   */
+  template<typename Member, std::size_t First, typename Columns>
+  class member_columns {
+  public:
+    using reference = member_reference<std::conditional_t<std::is_const_v<Columns>, Member const, Member>>;
+
+    constexpr explicit member_columns(Columns& columns) : columns_(columns) { }
+
+    constexpr reference at(size_type const index) const { return make_reference<Member, First>(columns_, index); }
+
+    constexpr reference operator[](size_type const index) const { return at(index); }
+
+    [[nodiscard]] constexpr size_type size() const noexcept { return columns_.size(); }
+
+  private:
+    Columns& columns_;
+  };
+
+  // ********* Constructors *********
+
+  constexpr flat_multi_vector() = default;
+
+  constexpr flat_multi_vector(std::initializer_list<value_type> init) { append_range(init); }
+
+  constexpr explicit flat_multi_vector(std::integral auto size) : columns_(size) { }
+
+  constexpr explicit flat_multi_vector(allocator_type const& alloc) :
+    columns_(typename columns_type::allocator_type(alloc)) { }
+
+  /**********************************
+   *        Member functions        *
+   **********************************/
+
+  // ********** Element access **********
+
+  /**
+   * Reference tuple to the element at `index`, one reference per flattened member
+   */
+  template<typename Self>
+  constexpr auto at(this Self&& self, std::size_t const index) {
+    return self.columns_.at(index);
+  }
+
+  template<typename Self>
+  constexpr auto operator[](this Self&& self, std::size_t const index) {
+    return self.columns_.at(index);
+  }
+
+  template<typename Self>
+  constexpr auto front(this Self&& self) {
+    return self.columns_.front();
+  }
+
+  template<typename Self>
+  constexpr auto back(this Self&& self) {
+    return self.columns_.back();
+  }
+
+  /**
+   * `I`-th flattened column
+   */
+  template<std::size_t I, typename Self>
+  constexpr decltype(auto) items(this Self& self) {
+    return (self.columns_.template items<I>());
+  }
+
+  /**
+   * Column of member `name` of `T`, or a `member_columns` view if the member is flattened
+   */
+  template<char const* name, typename Self>
+  constexpr decltype(auto) items(this Self& self) {
+    constexpr auto member = nonstatic_data_member<value_type>(name);
+    constexpr auto first  = detail::leaf_offset(member);
+    if constexpr (detail::is_flattenable(type_of(member))) {
+      using columns = std::remove_reference_t<decltype((self.columns_))>;
+      return member_columns<typename[:type_of(member):], first, columns>(self.columns_);
+    }
+    else {
+      return (self.columns_.template items<first>());
+    }
+  }
+
+  /**
+   * Structure of spans over every flattened column, see `multi_vector::spans`
+   */
+  template<typename Self>
+  constexpr auto spans(this Self& self) {
+    return self.columns_.spans();
+  }
+
+  constexpr auto to_zip() { return columns_.to_zip(); }
+
+  [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+    return allocator_type(columns_.get_allocator());
+  }
+
+  // ********* Iterators *********
+
+  template<typename Self>
+  constexpr auto begin(this Self&& self) noexcept {
+    return std::forward<Self>(self).columns_.begin();
+  }
+
+  template<typename Self>
+  constexpr auto end(this Self&& self) noexcept {
+    return std::forward<Self>(self).columns_.end();
+  }
+
+  constexpr auto cbegin() const noexcept { return columns_.cbegin(); }
+
+  constexpr auto cend() const noexcept { return columns_.cend(); }
+
+  // ********* Modifiers *********
+
+  constexpr void push_back(value_type const& item) { columns_.push_back(flatten(item)); }
+
+  /**
+   * Appends a tuple with one value per flattened member, like the ones returned by `at`
+   */
+  constexpr void push_back(auto const value) { columns_.push_back(value); }
+
+  constexpr void pop_back() { columns_.pop_back(); }
+
+  constexpr auto erase(iterator const it) { return columns_.erase(it); }
+
+  constexpr auto erase(iterator const begin_it, iterator const end_it) { return columns_.erase(begin_it, end_it); }
+
+  /**
+   * Appends every element of an AoS range, flattening them on the fly
+   */
+  template<std::ranges::forward_range R>
+    requires(std::convertible_to<std::ranges::range_reference_t<R>, value_type const&>)
+  constexpr void append_range(R&& range) {
+    columns_.append_range(std::forward<R>(range) | flattened);
+  }
+
+  template<std::forward_iterator It>
+    requires(std::convertible_to<std::iter_reference_t<It>, value_type const&>)
+  constexpr auto insert(iterator const pos, It const first, It const last) {
+    auto range = std::ranges::subrange(first, last) | flattened;
+    return columns_.insert(pos, std::ranges::begin(range), std::ranges::end(range));
+  }
+
+  constexpr void resize(std::size_t const new_size) { columns_.resize(new_size); }
+
+  // ********* Capacity *********
+
+  [[nodiscard]] constexpr bool empty() const noexcept { return columns_.empty(); }
+
+  [[nodiscard]] constexpr std::size_t size() const noexcept { return columns_.size(); }
+
+  [[nodiscard]] constexpr std::size_t max_size() const noexcept { return columns_.max_size(); }
+
+  [[nodiscard]] constexpr std::size_t capacity() const noexcept { return columns_.capacity(); }
+
+  constexpr void reserve(std::size_t const new_capacity) { columns_.reserve(new_capacity); }
+
+private:
+  static constexpr auto flattened =
+      std::views::transform([](value_type const& item) { return flatten(item); });
+
+  /**
+   * Reference to the flattened member of type `Member` whose first column is `First`, for the element at `index`
+   */
+  template<typename Member, std::size_t First, typename Columns>
+  static constexpr auto make_reference(Columns& columns, std::size_t const index) {
+    using reference  = typename member_columns<Member, First, Columns>::reference;
+    using references = typename reference::references_type;
+    return reference([&]<std::size_t... I>(std::index_sequence<I...>) {
+      return references {reference_to<nonstatic_data_member<Member>(I), First>(columns, index)...};
+    }(std::make_index_sequence<members_count<Member>>()));
+  }
+
+  template<std::meta::info Member, std::size_t First, typename Columns>
+  static constexpr decltype(auto) reference_to(Columns& columns, std::size_t const index) {
+    constexpr auto leaf = First + detail::leaf_offset(Member);
+    if constexpr (detail::is_flattenable(type_of(Member))) {
+      return make_reference<typename[:type_of(Member):], leaf>(columns, index);
+    }
+    else {
+      return (columns.template items<leaf>()[index]);
+    }
+  }
+
+  template<typename Record>
+  static constexpr auto members_count =
+      (nonstatic_data_members_of(^^Record, std::meta::access_context::unchecked())).size();
+
+  columns_type columns_ {};
+};
+
+} // namespace rflect
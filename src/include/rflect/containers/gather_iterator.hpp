@@ -0,0 +1,116 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file gather_iterator.hpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Gather iterator class
+ */
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <iterator>
+
+namespace rflect {
+
+namespace detail {
+
+/**
+ * @brief Index based iterator over containers that scatter the members of an element.
+ *
+ * Elements of tiled and split containers are spread across several arrays, so there is no object to
+ * reference. Dereferencing gathers the element into a `value_type` copy.
+ *
+ * Like `proxy_iterator`, the iterator is only an index into its container, so it models
+ * `std::random_access_iterator`, while legacy algorithms only see an input iterator (`iterator_category`) as the
+ * reference is not a language reference.
+ *
+ * @tparam Container Container type providing `at(index)`, const qualified for const iterators.
+ */
+template<typename Container>
+class gather_iterator {
+public:
+  using iterator_concept  = std::random_access_iterator_tag;
+  using iterator_category = std::input_iterator_tag;
+  using difference_type   = std::ptrdiff_t;
+  using value_type        = typename std::remove_const_t<Container>::value_type;
+  using reference         = value_type;
+  using container         = Container;
+
+  constexpr gather_iterator() = default;
+
+  constexpr gather_iterator(container& container, std::size_t const index) : index_(index), container_(&container) { }
+
+  constexpr gather_iterator& operator++() {
+    ++index_;
+    return *this;
+  }
+
+  constexpr gather_iterator operator++(int) {
+    gather_iterator old = *this;
+    ++(*this);
+    return old;
+  }
+
+  constexpr gather_iterator& operator--() {
+    --index_;
+    return *this;
+  }
+
+  constexpr gather_iterator operator--(int) {
+    gather_iterator old = *this;
+    --(*this);
+    return old;
+  }
+
+  constexpr gather_iterator& operator+=(difference_type const offset) {
+    index_ += static_cast<std::size_t>(offset);
+    return *this;
+  }
+
+  constexpr gather_iterator& operator-=(difference_type const offset) {
+    index_ -= static_cast<std::size_t>(offset);
+    return *this;
+  }
+
+  constexpr value_type operator*() const { return container_->at(index_); }
+
+  constexpr value_type operator[](difference_type const offset) const {
+    return container_->at(index_ + static_cast<std::size_t>(offset));
+  }
+
+  friend constexpr gather_iterator operator+(gather_iterator const& it, difference_type const index) {
+    return {*it.container_, it.index_ + index};
+  }
+
+  friend constexpr gather_iterator operator+(difference_type const index, gather_iterator const& it) {
+    return it + index;
+  }
+
+  friend constexpr gather_iterator operator-(gather_iterator const& it, difference_type const index) {
+    return {*it.container_, it.index_ - index};
+  }
+
+  friend constexpr difference_type operator-(gather_iterator const& it1, gather_iterator const& it2) {
+    return static_cast<difference_type>(it1.index_) - static_cast<difference_type>(it2.index_);
+  }
+
+  friend constexpr bool operator==(gather_iterator const& it1, gather_iterator const& it2) {
+    return it1.index_ == it2.index_ and it1.container_ == it2.container_;
+  }
+
+  friend constexpr std::strong_ordering operator<=>(gather_iterator const& it1, gather_iterator const& it2) {
+    return it1.index_ <=> it2.index_;
+  }
+
+private:
+  std::size_t index_ {};
+  container* container_ {};
+};
+
+} // namespace detail
+
+} // namespace rflect
@@ -16,7 +16,9 @@
 
 #include <rflect/concepts/layout_concepts.hpp>
 
+#include <compare>
 #include <iterator>
+#include <utility>
 
 namespace rflect {
 
@@ -27,15 +29,22 @@ namespace rflect {
  * they are using a Structure of Arrays (SoA) or Array of Structures (AoS) layout.
  * It provides standard iterator functionality to access container elements through a proxy type.
  *
+ * The iterator is only an index into its container, so it models `std::random_access_iterator`. Dereferencing
+ * yields a proxy by value, the position of an iterator can be mapped onto the member spans of SoA containers
+ * through `index()`. `iter_move` and `iter_swap` go through copies of the element type, which lets `std::ranges`
+ * algorithms such as `std::ranges::sort` permute the container. As the reference is not a language reference, legacy
+ * algorithms only see an input iterator (`iterator_category`).
+ *
  * @tparam ViewType Proxy type used to access elements in the container.
  */
 template<typename ViewType>
 class proxy_iterator {
 public:
-  using iterator_category = std::forward_iterator_tag;
+  using iterator_concept  = std::random_access_iterator_tag;
+  using iterator_category = std::input_iterator_tag;
   using difference_type   = std::ptrdiff_t;
-  using value_type        = ViewType;
-  using reference         = ViewType&;
+  using value_type        = typename ViewType::value_type;
+  using reference         = ViewType;
   using pointer           = ViewType*;
   using container         = typename ViewType::underlying_container;
 
@@ -54,30 +63,79 @@ public:
     return old;
   }
 
+  constexpr proxy_iterator& operator--() {
+    --index_;
+    return *this;
+  }
+
+  constexpr proxy_iterator operator--(int) {
+    proxy_iterator old = *this;
+    --(*this);
+    return old;
+  }
+
+  constexpr proxy_iterator& operator+=(difference_type const offset) {
+    index_ += static_cast<std::size_t>(offset);
+    return *this;
+  }
+
+  constexpr proxy_iterator& operator-=(difference_type const offset) {
+    index_ -= static_cast<std::size_t>(offset);
+    return *this;
+  }
+
   template<typename Self>
-  constexpr value_type operator*(this Self&& self) {
+  constexpr reference operator*(this Self&& self) {
     return {*std::forward<Self>(self).container_, std::forward<Self>(self).index_};
   }
 
+  constexpr reference operator[](difference_type const offset) const {
+    return {*container_, index_ + static_cast<std::size_t>(offset)};
+  }
+
+  /**
+   * Position of the iterator inside its container
+   */
+  [[nodiscard]] constexpr std::size_t index() const noexcept { return index_; }
+
   friend constexpr proxy_iterator operator+(proxy_iterator const& proxy1, difference_type const index) {
     return {*proxy1.container_, proxy1.index_ + index};
   }
 
+  friend constexpr proxy_iterator operator+(difference_type const index, proxy_iterator const& proxy1) {
+    return proxy1 + index;
+  }
+
   friend constexpr proxy_iterator operator-(proxy_iterator const& proxy1, difference_type const index) {
     return {*proxy1.container_, proxy1.index_ - index};
   }
 
   friend constexpr difference_type operator-(proxy_iterator const& proxy1, proxy_iterator const& proxy2) {
-    return proxy1.index_ - proxy2.index_;
+    return static_cast<difference_type>(proxy1.index_) - static_cast<difference_type>(proxy2.index_);
   }
 
   friend constexpr bool operator==(proxy_iterator const& proxy1, proxy_iterator const& proxy2) {
     return proxy1.index_ == proxy2.index_ and proxy1.container_ == proxy2.container_;
   }
 
+  /**
+   * Copy of the element, the proxy itself cannot be moved from
+   */
+  friend constexpr value_type iter_move(proxy_iterator const& it) { return static_cast<value_type>(*it); }
+
+  friend constexpr void iter_swap(proxy_iterator const& it1, proxy_iterator const& it2) {
+    value_type value = *it1;
+    *it1             = *it2;
+    *it2             = std::move(value);
+  }
+
+  friend constexpr std::strong_ordering operator<=>(proxy_iterator const& proxy1, proxy_iterator const& proxy2) {
+    return proxy1.index_ <=> proxy2.index_;
+  }
+
 private:
   std::size_t index_ {};
-  container* container_;
+  container* container_ {};
 };
 
 } // namespace rflect
@@ -11,7 +11,14 @@
 
 #pragma once
 
+#include <rflect/containers/flat_multi_vector.hpp>
 #include <rflect/containers/multi_vector.hpp>
+#include <rflect/containers/packed_multi_vector.hpp>
+#include <rflect/containers/small_multi_vector.hpp>
+#include <rflect/containers/split_array.hpp>
+#include <rflect/containers/split_vector.hpp>
+#include <rflect/containers/tiled_array.hpp>
+#include <rflect/containers/tiled_vector.hpp>
 #include <rflect/converters/struct_to_soa.hpp>
 
 #include <array>
@@ -51,4 +58,104 @@ struct soa {
   using vector = multi_vector<T, Alloc>;
 };
 
+/**
+ * @brief Layout for Structure of Arrays (SoA) with aligned, padded columns.
+ *
+ * The `aligned_soa` structure behaves like `soa`, but every column of its vector starts on an `Align` boundary and
+ * is padded to a multiple of `Align` bytes (e.g. 64 for cache lines and AVX-512 registers). Arrays are not over
+ * aligned.
+ *
+ * @tparam Align Column alignment in bytes, a power of two
+ */
+template<std::size_t Align>
+struct aligned_soa {
+  template<class T, std::size_t N>
+  using array = multi_array<T, N>;
+
+  template<class T, template<class> class Alloc>
+  using vector = multi_vector<T, Alloc, Align>;
+};
+
+/**
+ * @brief Layout for Structure of Arrays (SoA) with flattened class type members.
+ *
+ * The `soa_flat` structure behaves like `soa`, but its vector splits class type members (e.g. a `vec3`) into one
+ * column per member, recursively, and proxies return a `member_reference` for them. Arrays are not flattened.
+ */
+struct soa_flat {
+  template<class T, std::size_t N>
+  using array = multi_array<T, N>;
+
+  template<class T, template<class> class Alloc>
+  using vector = flat_multi_vector<T, Alloc>;
+};
+
+/**
+ * @brief Layout for Structure of Arrays (SoA) with a single backing allocation.
+ *
+ * The `packed_soa` structure behaves like `soa`, but its vector keeps every member column inside one buffer, so
+ * growing the container performs one allocation instead of one per member.
+ */
+struct packed_soa {
+  template<class T, std::size_t N>
+  using array = multi_array<T, N>;
+
+  template<class T, template<class> class Alloc>
+  using vector = packed_multi_vector<T, Alloc>;
+};
+
+/**
+ * @brief Layout for Structure of Arrays (SoA) with inline storage.
+ *
+ * The `soa_small` structure behaves like `soa`, but its vector keeps up to `N` elements per column inside the
+ * container and only allocates heap columns beyond that. Suited to many small containers, like the cells of a grid.
+ *
+ * @tparam N Inline capacity, in elements per column
+ */
+template<std::size_t N>
+struct soa_small {
+  template<class T, std::size_t Size>
+  using array = multi_array<T, Size>;
+
+  template<class T, template<class> class Alloc>
+  using vector = small_multi_vector<T, N, Alloc>;
+};
+
+/**
+ * @brief Layout for Array of Structures of Arrays (AoSoA).
+ *
+ * The `aosoa` structure defines the types used for a tiled layout, where data is stored as an array of tiles and
+ * every tile is a structure of arrays holding `Lanes` elements. Members are contiguous within a tile (SIMD friendly)
+ * while all members of an element are kept within the same tile.
+ *
+ * @tparam Lanes Number of elements per tile (e.g. 8 or 16)
+ */
+template<std::size_t Lanes>
+struct aosoa {
+  template<class T, std::size_t N>
+  using array = tiled_array<T, N, Lanes>;
+
+  template<class T, template<class> class Alloc>
+  using vector = tiled_vector<T, Lanes, Alloc>;
+};
+
+/**
+ * @brief Layout splitting hot and cold members.
+ *
+ * The `split` structure defines the types used for a hybrid layout, where the members designated by `HotMembers`
+ * are stored as a structure of arrays and the remaining (cold) members are kept together as an array of structures
+ * indexed like the hot columns. Loops touching only hot members stream dense columns without dragging the cold
+ * members through the cache.
+ *
+ * @tparam HotMembers Pointers to the hot data members (e.g. `&Particle::position`)
+ */
+template<auto... HotMembers>
+struct split {
+  template<class T, std::size_t N>
+  using array = split_array<T, N, HotMembers...>;
+
+  template<class T, template<class> class Alloc>
+  using vector = split_vector<T, Alloc, HotMembers...>;
+};
+
 } // namespace rflect::layout
@@ -48,19 +48,24 @@ public:
 
   // ********* Element access *********
 
+  /**
+   * Reference tuple to the element at `index`, indexing every column directly instead of going through a zip view
+   */
   template<typename Self>
-  constexpr auto at(this Self self, std::size_t const index) {
-    return soa_to_zip(self.data_)[index];
+  constexpr auto at(this Self& self, std::size_t const index) {
+    return [&]<std::size_t... I>(std::index_sequence<I...>) {
+      return std::tie(self.data_.[:nonstatic_data_member<underlying_container>(I):][index]...);
+    }(std::make_index_sequence<members_count>());
   }
 
   template<typename Self>
-  constexpr auto operator[](this Self self, std::size_t const index) {
+  constexpr auto operator[](this Self& self, std::size_t const index) {
     return self.at(index);
   }
 
   template<typename Self>
-  constexpr auto front(this Self self) {
-    return soa_to_zip(self.data_)[0];
+  constexpr auto front(this Self& self) {
+    return self.at(0);
   }
 
   template<std::size_t Idx, typename Self>
@@ -75,15 +80,29 @@ public:
 
   constexpr auto to_zip() { return soa_to_zip(data_); }
 
+  /**
+   * Non owning structure of spans over every column
+   */
+  template<typename Self>
+  constexpr auto spans(this Self& self) {
+    using spans_type = std::conditional_t<std::is_const_v<Self>, struct_of_spans<T const>, struct_of_spans<T>>;
+    spans_type spans {};
+    template for (constexpr auto index: std::views::iota(0UZ, members_count)) {
+      constexpr auto column = nonstatic_data_member<underlying_container>(index);
+      spans.[:nonstatic_data_member<spans_type>(index):] = self.data_.[:column:];
+    }
+    return spans;
+  }
+
   // ********* Iterators *********
 
   template<typename Self>
-  constexpr auto begin(this Self self) noexcept {
+  constexpr auto begin(this Self& self) noexcept {
     return std::begin(soa_to_zip(self.data_));
   }
 
   template<typename Self>
-  constexpr auto end(this Self self) noexcept {
+  constexpr auto end(this Self& self) noexcept {
     return std::end(soa_to_zip(self.data_));
   }
 
@@ -106,6 +125,8 @@ public:
   }
 
 private:
+  static constexpr auto members_count =
+      (nonstatic_data_members_of(^^underlying_container, std::meta::access_context::unchecked())).size();
   underlying_container data_ {};
 };
 
@@ -16,6 +16,9 @@
 #include <rflect/converters/to_static.hpp>
 #include <rflect/introspection/struct.hpp>
 
+#include <memory_resource>
+#include <span>
+
 namespace rflect {
 
 /**
@@ -26,9 +29,13 @@ namespace rflect {
  * (e.g., std::vector), making it easy to use and integrate.
  *
  * @tparam T Aggregate type to be converted
- * @tparam Alloc Allocator type for vectors
+ * @tparam Alloc Allocator type for vectors. Stateful allocators passed to the constructors are rebound to every column,
+ * so all of them allocate from the same place (e.g. `pmr::multi_vector` over a `std::pmr::monotonic_buffer_resource`)
+ * @tparam Align Column alignment in bytes. When not 0 every column starts on an `Align` boundary and its storage is
+ * padded to a multiple of `Align` bytes (see `aligned_allocator`). `padded_items` exposes that padding, so vector
+ * loops such as `transform_columns` use aligned loads and need no peeling nor remainder
  */
-template<typename T, template<typename> class Alloc = std::allocator>
+template<typename T, template<typename> class Alloc = std::allocator, std::size_t Align = 0>
   requires(std::is_aggregate_v<T>) // TODO concept this type trait
 class multi_vector {
 public:
@@ -36,10 +43,13 @@ public:
    *          Member types          *
    **********************************/
   using value_type           = T;
-  using underlying_container = struct_of_vectors<T, Alloc>;
+  using allocator_type       = Alloc<T>;
+  using underlying_container = struct_of_vectors<T, Alloc, Align>;
   using iterator             = decltype(std::begin(std::declval<as_zip<underlying_container>>()));
   using const_iterator       = decltype(std::cbegin(std::declval<as_zip<underlying_container>>()));
 
+  static constexpr std::size_t column_alignment = Align;
+
 
   // ********* Constructors *********
 
@@ -59,16 +69,38 @@ public:
     }
   }
 
+  /**
+   * Every column is constructed with its own copy of `alloc` rebound to the column type. Columns are built in place
+   * because allocators such as `std::pmr::polymorphic_allocator` do not propagate on assignment
+   */
+  constexpr explicit multi_vector(allocator_type const& alloc) : data_(make_columns(alloc)) { }
+
+  constexpr multi_vector(std::integral auto size, allocator_type const& alloc) : data_(make_columns(alloc)) {
+    resize(static_cast<std::size_t>(size));
+  }
+
+  constexpr multi_vector(std::initializer_list<value_type> init, allocator_type const& alloc) :
+    data_(make_columns(alloc)) {
+    reserve(init.size());
+    for (auto const& item: init) {
+      push_back(item);
+    }
+  }
+
   /**********************************
    *        Member functions        *
    **********************************/
 
   // ********** Element access **********
 
+  /**
+   * Reference tuple to the element at `index`, indexing every column directly instead of going through a zip view
+   */
   template<typename Self>
   constexpr auto at(this Self&& self, std::size_t const index) {
-    static auto zip = soa_to_zip(self.data_);
-    return zip[index];
+    return [&]<std::size_t... I>(std::index_sequence<I...>) {
+      return std::tie(self.data_.[:nonstatic_data_member<underlying_container>(I):][index]...);
+    }(std::make_index_sequence<members_count>());
   }
 
   template<typename Self>
@@ -78,12 +110,12 @@ public:
 
   template<typename Self>
   constexpr auto front(this Self&& self) {
-    return soa_to_zip(self.data_)[0];
+    return self.at(0);
   }
 
   template<typename Self>
   constexpr auto back(this Self&& self) {
-    return soa_to_zip(self.data_)[self.size() - 1];
+    return self.at(self.size() - 1);
   }
 
   template<std::size_t N, typename Self>
@@ -96,8 +128,43 @@ public:
     return (self.data_.[:nonstatic_data_member<underlying_container>(name):]);
   }
 
+  /**
+   * Span over column `N` extended up to the end of its padding, a whole number of `Align` bytes. Elements past
+   * `size()` are padding: kernels may load and store them, but their values are unspecified
+   */
+  template<std::size_t N, typename Self>
+    requires(Align != 0)
+  constexpr auto padded_items(this Self& self) {
+    return padded_span(self.template items<N>());
+  }
+
+  template<char const* name, typename Self>
+    requires(Align != 0)
+  constexpr auto padded_items(this Self& self) {
+    return padded_span(self.template items<name>());
+  }
+
   constexpr auto to_zip() { return soa_to_zip(data_); }
 
+  [[nodiscard]] constexpr allocator_type get_allocator() const noexcept {
+    return allocator_type(data_.[:nonstatic_data_member<underlying_container>(0):].get_allocator());
+  }
+
+  /**
+   * Non owning structure of spans over every column. It can be kept across a hot loop to avoid going through the
+   * vectors on each access, but like iterators it is invalidated by any operation that grows or shrinks the container
+   */
+  template<typename Self>
+  constexpr auto spans(this Self& self) {
+    using spans_type = std::conditional_t<std::is_const_v<Self>, struct_of_spans<T const>, struct_of_spans<T>>;
+    spans_type spans {};
+    template for (constexpr auto index: std::views::iota(0UZ, members_count)) {
+      constexpr auto column = nonstatic_data_member<underlying_container>(index);
+      spans.[:nonstatic_data_member<spans_type>(index):] = self.data_.[:column:];
+    }
+    return spans;
+  }
+
   // ********* Iterators *********
 
   template<typename Self>
@@ -116,11 +183,26 @@ public:
 
   // ********* Modifiers *********
 
+  /**
+   * Appends `item` column by column. If a column throws, the columns already grown are shrunk back so they all keep the
+   * same size
+   */
   constexpr void push_back(value_type const& item) {
-    template for (constexpr auto member:
-                  nonstatic_data_members_of(^^underlying_container, std::meta::access_context::unchecked()) |
-                      to_static_array) {
-      data_.[:member:].push_back(item.[:nonstatic_data_member<value_type>(identifier_of(member)):]);
+    std::size_t pushed = 0;
+    try {
+      template for (constexpr auto index: std::views::iota(0UZ, members_count)) {
+        constexpr auto member = nonstatic_data_member<underlying_container>(index);
+        data_.[:member:].push_back(item.[:nonstatic_data_member<value_type>(identifier_of(member)):]);
+        ++pushed;
+      }
+    }
+    catch (...) {
+      template for (constexpr auto index: std::views::iota(0UZ, members_count)) {
+        if (index < pushed) {
+          data_.[:nonstatic_data_member<underlying_container>(index):].pop_back();
+        }
+      }
+      throw;
     }
   }
 
@@ -155,6 +237,39 @@ public:
     return begin() + diff_end;
   }
 
+  /**
+   * Appends every element of an AoS range. The range is transposed column by column, so each member vector grows
+   * once and is written sequentially
+   */
+  template<std::ranges::forward_range R>
+    requires(std::convertible_to<std::ranges::range_reference_t<R>, value_type const&>)
+  constexpr void append_range(R&& range) {
+    template for (constexpr auto index: std::views::iota(0UZ, members_count)) {
+      data_.[:nonstatic_data_member<underlying_container>(index):].append_range(range | project<index>);
+    }
+  }
+
+  /**
+   * Inserts the AoS range [first, last) before `pos`, one column at a time
+   */
+  template<std::forward_iterator It>
+    requires(std::convertible_to<std::iter_reference_t<It>, value_type const&>)
+  constexpr auto insert(iterator const pos, It const first, It const last) {
+    auto const diff  = pos - begin();
+    auto const range = std::ranges::subrange(first, last);
+    template for (constexpr auto index: std::views::iota(0UZ, members_count)) {
+      auto& column = data_.[:nonstatic_data_member<underlying_container>(index):];
+      column.insert_range(column.begin() + diff, range | project<index>);
+    }
+    return begin() + diff;
+  }
+
+  constexpr void resize(std::size_t const new_size) {
+    template for (constexpr auto index: std::views::iota(0UZ, members_count)) {
+      data_.[:nonstatic_data_member<underlying_container>(index):].resize(new_size);
+    }
+  }
+
   // ********* Capacity *********
 
   [[nodiscard]] constexpr std::size_t empty() const noexcept {
@@ -173,10 +288,53 @@ public:
     return data_.[:nonstatic_data_member<underlying_container>(0):].capacity();
   }
 
+  constexpr void reserve(std::size_t const new_capacity) {
+    template for (constexpr auto index: std::views::iota(0UZ, members_count)) {
+      data_.[:nonstatic_data_member<underlying_container>(index):].reserve(new_capacity);
+    }
+  }
+
 private:
+  template<typename Column>
+  static constexpr auto padded_span(Column& column) {
+    using allocator = typename std::remove_const_t<Column>::allocator_type;
+    using element   = typename std::remove_const_t<Column>::value_type;
+    return std::span(column.data(), allocator::padded_bytes(column.size()) / sizeof(element));
+  }
+
   static constexpr auto members_count =
       (nonstatic_data_members_of(^^underlying_container, std::meta::access_context::unchecked())).size();
+
+  template<std::size_t N>
+  using column_type = typename[:type_of(nonstatic_data_member<underlying_container>(N)):];
+
+  static constexpr underlying_container make_columns(allocator_type const& alloc) {
+    return [&]<std::size_t... I>(std::index_sequence<I...>) {
+      return underlying_container {column_type<I>(typename column_type<I>::allocator_type(alloc))...};
+    }(std::make_index_sequence<members_count>());
+  }
+
+  // Projects an AoS element onto its N-th member
+  template<std::size_t N>
+  static constexpr auto project = std::views::transform([](value_type const& item) -> decltype(auto) {
+    return (item.[:nonstatic_data_member<value_type>(N):]);
+  });
   underlying_container data_ {};
 };
 
+namespace pmr {
+
+/**
+ * @brief `multi_vector` whose columns allocate from a `std::pmr::memory_resource`
+ *
+ * ```cpp
+ * std::pmr::monotonic_buffer_resource arena;
+ * rflect::pmr::multi_vector<Particle> scratch(&arena);
+ * ```
+ */
+template<typename T, std::size_t Align = 0>
+using multi_vector = rflect::multi_vector<T, std::pmr::polymorphic_allocator, Align>;
+
+} // namespace pmr
+
 } // namespace rflect
@@ -0,0 +1,506 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file packed_multi_vector.hpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Packed multi vector class
+ *
+ * Structure of arrays container keeping every member column inside a
+ * single aligned allocation
+ */
+
+#pragma once
+
+#include <rflect/converters/soa_to_zip.hpp>
+#include <rflect/converters/struct_to_soa.hpp>
+#include <rflect/converters/to_static.hpp>
+#include <rflect/introspection/struct.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+namespace rflect {
+
+namespace detail {
+
+/**
+ * Allocation unit of packed containers, one cache line. Allocating blocks instead of bytes
+ * guarantees that the buffer, and therefore every column, starts at a cache line boundary.
+ */
+struct alignas(64) column_block {
+  std::byte bytes[64];
+};
+
+} // namespace detail
+
+/**
+ * @brief Structure of arrays container with a single backing allocation
+ *
+ * Same interface as `multi_vector`, but instead of owning one `std::vector` per member all columns live in one
+ * buffer. Each column starts at a cache line aligned offset computed from the capacity, so growing the container
+ * is a single allocation (and a single capacity check) for every member at once. Columns are exposed as
+ * `std::span`s through `items()`.
+ *
+ * @tparam T Aggregate type to be converted
+ * @tparam Alloc Allocator template, instantiated with the cache line sized block type
+ */
+template<typename T, template<typename> class Alloc = std::allocator>
+  requires(std::is_aggregate_v<T>)
+class packed_multi_vector {
+public:
+  /**********************************
+   *          Member types          *
+   **********************************/
+  using value_type           = T;
+  using underlying_container = struct_of_spans<T>;
+  using const_container      = struct_of_spans<T const>;
+  using iterator             = decltype(std::begin(std::declval<as_zip<underlying_container>>()));
+  using const_iterator       = decltype(std::begin(std::declval<as_zip<const_container>>()));
+  using size_type            = std::size_t;
+  using allocator_type       = Alloc<detail::column_block>;
+
+  static constexpr size_type column_alignment = sizeof(detail::column_block);
+
+  // ********* Constructors *********
+
+  constexpr packed_multi_vector() = default;
+
+  constexpr packed_multi_vector(std::initializer_list<value_type> init) : packed_multi_vector() {
+    reserve(init.size());
+    for (auto const& item: init) {
+      push_back(item);
+    }
+  }
+
+  constexpr explicit packed_multi_vector(std::integral auto size) : packed_multi_vector() {
+    resize(static_cast<size_type>(size));
+  }
+
+  /**
+   * Every column lives in a single buffer, so `alloc` (rebound to the block type) serves all of them
+   */
+  template<typename U>
+  constexpr explicit packed_multi_vector(Alloc<U> const& alloc) : alloc_(alloc) { }
+
+  constexpr packed_multi_vector(packed_multi_vector const& other) :
+    packed_multi_vector(std::allocator_traits<allocator_type>::select_on_container_copy_construction(other.alloc_)) {
+    reserve(other.size_);
+    construct_columns(columns_, size_, other.size_, [&](auto const index, auto* const column) {
+      std::uninitialized_copy_n(other.columns_.[:column_member(index):], other.size_, column);
+    });
+    size_ = other.size_;
+  }
+
+  constexpr packed_multi_vector(packed_multi_vector&& other) noexcept :
+    alloc_(std::move(other.alloc_)), buffer_(std::exchange(other.buffer_, nullptr)),
+    columns_(std::exchange(other.columns_, {})), size_(std::exchange(other.size_, 0)),
+    capacity_(std::exchange(other.capacity_, 0)) { }
+
+  /**
+   * Allocators that do not propagate on swap keep serving this container. Unless they compare equal, the elements of
+   * `other` are then moved into a buffer from `alloc_`
+   */
+  constexpr packed_multi_vector& operator=(packed_multi_vector other) {
+    if (std::allocator_traits<allocator_type>::propagate_on_container_swap::value or alloc_ == other.alloc_) {
+      swap(other);
+      return *this;
+    }
+    clear();
+    reserve(other.size_);
+    construct_columns(columns_, 0, other.size_, [&other](auto const index, auto* const column) {
+      relocate(other.columns_.[:column_member(index):], other.size_, column);
+    });
+    size_ = other.size_;
+    return *this;
+  }
+
+  constexpr ~packed_multi_vector() { release(); }
+
+  /**********************************
+   *        Member functions        *
+   **********************************/
+
+  // ********** Element access **********
+
+  /**
+   * Reference tuple to the element at `index`, indexing every column directly instead of going through a zip view
+   */
+  template<typename Self>
+  constexpr auto at(this Self&& self, std::size_t const index) {
+    auto spans = self.spans();
+    return [&]<std::size_t... I>(std::index_sequence<I...>) {
+      return std::tie(spans.[:nonstatic_data_member<decltype(spans)>(I):][index]...);
+    }(std::make_index_sequence<members_count>());
+  }
+
+  template<typename Self>
+  constexpr auto operator[](this Self&& self, std::size_t const index) {
+    return self.at(index);
+  }
+
+  template<typename Self>
+  constexpr auto front(this Self&& self) {
+    return self.at(0);
+  }
+
+  template<typename Self>
+  constexpr auto back(this Self&& self) {
+    return self.at(self.size_ - 1);
+  }
+
+  template<std::size_t N, typename Self>
+  constexpr auto items(this Self& self) {
+    auto spans = self.spans();
+    return spans.[:nonstatic_data_member<decltype(spans)>(N):];
+  }
+
+  template<char const* name, typename Self>
+  constexpr auto items(this Self& self) {
+    auto spans = self.spans();
+    return spans.[:nonstatic_data_member<decltype(spans)>(name):];
+  }
+
+  /**
+   * Non owning structure of spans over the first `size()` elements of every column
+   */
+  template<typename Self>
+  constexpr auto spans(this Self& self) {
+    using spans_type = std::conditional_t<std::is_const_v<Self>, const_container, underlying_container>;
+    spans_type spans {};
+    template for (constexpr auto index: std::views::iota(0UZ, members_count)) {
+      constexpr auto span_member   = nonstatic_data_member<spans_type>(index);
+      constexpr auto column_member = nonstatic_data_member<struct_of_pointers<T>>(index);
+      spans.[:span_member:]        = {self.columns_.[:column_member:], self.size_};
+    }
+    return spans;
+  }
+
+  template<typename Self>
+  constexpr auto to_zip(this Self& self) {
+    return soa_to_zip(self.spans());
+  }
+
+  [[nodiscard]] constexpr allocator_type get_allocator() const noexcept { return alloc_; }
+
+  // ********* Iterators *********
+
+  template<typename Self>
+  constexpr auto begin(this Self& self) noexcept {
+    return std::begin(self.to_zip());
+  }
+
+  template<typename Self>
+  constexpr auto end(this Self& self) noexcept {
+    return std::end(self.to_zip());
+  }
+
+  constexpr const_iterator cbegin() const noexcept { return begin(); }
+
+  constexpr const_iterator cend() const noexcept { return end(); }
+
+  // ********* Modifiers *********
+
+  constexpr void push_back(value_type const& item) {
+    grow_for(size_ + 1);
+    construct_columns(columns_, size_, 1, [&item](auto const index, auto* const column) {
+      std::construct_at(column, item.[:nonstatic_data_member<value_type>(identifier_of(column_member(index))):]);
+    });
+    ++size_;
+  }
+
+  /**
+   * Appends a tuple with one value per member. The tuple may reference elements of this container (e.g. `*v[0]`
+   * forwarded by `dual_vector::push_back`), so it is copied into a `value_type` first when the buffer has to move
+   */
+  constexpr void push_back(auto const value) {
+    if (size_ == capacity_) {
+      push_back(std::apply([](auto const&... members) { return value_type {members...}; }, value));
+      return;
+    }
+    construct_columns(columns_, size_, 1, [&value](auto const index, auto* const column) {
+      std::construct_at(column, std::get<index()>(value));
+    });
+    ++size_;
+  }
+
+  constexpr void pop_back() {
+    --size_;
+    template for (constexpr auto member: column_members()) {
+      std::destroy_at(columns_.[:member:] + size_);
+    }
+  }
+
+  constexpr auto erase(iterator const it) {
+    auto const index = static_cast<size_type>(it - begin());
+    return erase_range(index, index + 1);
+  }
+
+  constexpr auto erase(iterator const begin_it, iterator const end_it) {
+    return erase_range(static_cast<size_type>(begin_it - begin()), static_cast<size_type>(end_it - begin()));
+  }
+
+  /**
+   * Appends every element of an AoS range. The buffer grows at most once and the range is transposed column by
+   * column, so each column is written sequentially
+   */
+  template<std::ranges::forward_range R>
+    requires(std::convertible_to<std::ranges::range_reference_t<R>, value_type const&>)
+  constexpr void append_range(R&& range) {
+    auto const count = static_cast<size_type>(std::ranges::distance(range));
+    grow_for(size_ + count);
+    construct_columns(columns_, size_, count, [&range, count](auto const index, auto* const column) {
+      std::ranges::uninitialized_copy(range | project<index()>, std::span(column, count));
+    });
+    size_ += count;
+  }
+
+  /**
+   * Inserts the AoS range [first, last) before `pos`. Elements are appended and then rotated into place
+   */
+  template<std::forward_iterator It>
+    requires(std::convertible_to<std::iter_reference_t<It>, value_type const&>)
+  constexpr auto insert(iterator const pos, It const first, It const last) {
+    auto const index    = static_cast<size_type>(pos - begin());
+    auto const old_size = size_;
+    append_range(std::ranges::subrange(first, last));
+    template for (constexpr auto member: column_members()) {
+      auto* const column = columns_.[:member:];
+      std::rotate(column + index, column + old_size, column + size_);
+    }
+    return begin() + static_cast<std::ptrdiff_t>(index);
+  }
+
+  constexpr void resize(size_type const new_size) {
+    if (new_size < size_) {
+      erase_range(new_size, size_);
+      return;
+    }
+    reserve(new_size);
+    construct_columns(columns_, size_, new_size - size_, [this, new_size](auto, auto* const column) {
+      std::uninitialized_value_construct_n(column, new_size - size_);
+    });
+    size_ = new_size;
+  }
+
+  constexpr void clear() noexcept {
+    template for (constexpr auto member: column_members()) {
+      std::destroy_n(columns_.[:member:], size_);
+    }
+    size_ = 0;
+  }
+
+  /**
+   * Allocators are only exchanged when they propagate on swap, otherwise they must compare equal as with standard
+   * containers
+   */
+  constexpr void swap(packed_multi_vector& other) noexcept {
+    if constexpr (std::allocator_traits<allocator_type>::propagate_on_container_swap::value) {
+      std::ranges::swap(alloc_, other.alloc_);
+    }
+    else {
+      assert(alloc_ == other.alloc_);
+    }
+    std::ranges::swap(buffer_, other.buffer_);
+    std::ranges::swap(columns_, other.columns_);
+    std::ranges::swap(size_, other.size_);
+    std::ranges::swap(capacity_, other.capacity_);
+  }
+
+  // ********* Capacity *********
+
+  [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+
+  [[nodiscard]] constexpr size_type size() const noexcept { return size_; }
+
+  [[nodiscard]] constexpr size_type max_size() const noexcept {
+    return std::allocator_traits<allocator_type>::max_size(alloc_) / row_bytes() * column_alignment;
+  }
+
+  [[nodiscard]] constexpr size_type capacity() const noexcept { return capacity_; }
+
+  /**
+   * Grows the buffer so it can hold `new_capacity` elements per column. All columns are relocated with
+   * one allocation. Strong guarantee: if a column cannot be relocated the new buffer is released and the container
+   * is left untouched (elements are copied unless their move constructor is `noexcept`)
+   */
+  constexpr void reserve(size_type const new_capacity) {
+    if (new_capacity <= capacity_) {
+      return;
+    }
+
+    allocation next(alloc_, buffer_bytes(new_capacity) / column_alignment);
+    auto const columns = columns_at(next.buffer, new_capacity);
+
+    construct_columns(columns, 0, size_, [this](auto const index, auto* const column) {
+      relocate(columns_.[:column_member(index):], size_, column);
+    });
+
+    template for (constexpr auto member: column_members()) {
+      std::destroy_n(columns_.[:member:], size_);
+    }
+    deallocate();
+    buffer_   = std::exchange(next.buffer, nullptr);
+    columns_  = columns;
+    capacity_ = new_capacity;
+  }
+
+private:
+  /**
+   * Buffer allocated by `reserve`, released on scope exit unless `reserve` takes it over
+   */
+  struct allocation {
+    constexpr allocation(allocator_type& alloc, size_type const blocks) :
+      alloc(alloc), blocks(blocks), buffer(std::allocator_traits<allocator_type>::allocate(alloc, blocks)) { }
+
+    allocation(allocation const&) = delete;
+
+    allocation& operator=(allocation const&) = delete;
+
+    constexpr ~allocation() {
+      if (buffer != nullptr) {
+        std::allocator_traits<allocator_type>::deallocate(alloc, buffer, blocks);
+      }
+    }
+
+    allocator_type& alloc;
+    size_type blocks;
+    detail::column_block* buffer;
+  };
+
+  /**
+   * Constructs `count` elements at `target` from `source`, moving them only if that cannot throw
+   */
+  template<typename U>
+  static constexpr void relocate(U* const source, size_type const count, U* const target) {
+    if constexpr (std::is_nothrow_move_constructible_v<U> or not std::is_copy_constructible_v<U>) {
+      std::uninitialized_move_n(source, count, target);
+    }
+    else {
+      std::uninitialized_copy_n(source, count, target);
+    }
+  }
+
+  /**
+   * Constructs `count` elements at `offset` of every column through `construct(index, column + offset)`, where
+   * `index` is the column position as a `std::integral_constant`. If a column throws, the columns already constructed
+   * are destroyed before rethrowing, so no element is left half built across columns
+   */
+  template<typename Fn>
+  static constexpr void construct_columns(
+      struct_of_pointers<T> const& columns, size_type const offset, size_type const count, Fn&& construct
+  ) {
+    size_type constructed = 0;
+    try {
+      template for (constexpr auto index: std::views::iota(0UZ, members_count)) {
+        construct(std::integral_constant<std::size_t, index> {}, columns.[:column_member(index):] + offset);
+        ++constructed;
+      }
+    }
+    catch (...) {
+      template for (constexpr auto index: std::views::iota(0UZ, members_count)) {
+        if (index < constructed) {
+          std::destroy_n(columns.[:column_member(index):] + offset, count);
+        }
+      }
+      throw;
+    }
+  }
+
+  static consteval std::meta::info column_member(std::size_t const index) {
+    return nonstatic_data_member<struct_of_pointers<T>>(index);
+  }
+
+  static consteval auto column_members() {
+    return nonstatic_data_members_of(^^struct_of_pointers<T>, std::meta::access_context::unchecked()) |
+           to_static_array;
+  }
+
+  // Projects an AoS element onto its N-th member
+  template<std::size_t N>
+  static constexpr auto project = std::views::transform([](value_type const& item) -> decltype(auto) {
+    return (item.[:nonstatic_data_member<value_type>(N):]);
+  });
+
+  static consteval size_type row_bytes() {
+    size_type bytes = 0;
+    template for (constexpr auto member: column_members()) {
+      bytes += sizeof(std::remove_pointer_t<typename[:type_of(member):]>);
+    }
+    return bytes;
+  }
+
+  static constexpr size_type align_up(size_type const offset) {
+    return (offset + column_alignment - 1) / column_alignment * column_alignment;
+  }
+
+  /**
+   * Bytes needed by a buffer holding `capacity` elements per column, every column starting at a cache line
+   */
+  static constexpr size_type buffer_bytes(size_type const capacity) {
+    size_type bytes = 0;
+    template for (constexpr auto member: column_members()) {
+      using column_type = std::remove_pointer_t<typename[:type_of(member):]>;
+      static_assert(alignof(column_type) <= column_alignment, "Over aligned members are not supported");
+      bytes = align_up(bytes) + (capacity * sizeof(column_type));
+    }
+    return align_up(bytes);
+  }
+
+  static constexpr auto columns_at(detail::column_block* const buffer, size_type const capacity) {
+    struct_of_pointers<T> columns {};
+    auto* const bytes = reinterpret_cast<std::byte*>(buffer); // NOLINT
+    size_type offset  = 0;
+    template for (constexpr auto member: column_members()) {
+      using column_type  = std::remove_pointer_t<typename[:type_of(member):]>;
+      offset             = align_up(offset);
+      columns.[:member:] = reinterpret_cast<column_type*>(bytes + offset); // NOLINT
+      offset += capacity * sizeof(column_type);
+    }
+    return columns;
+  }
+
+  constexpr void grow_for(size_type const new_size) {
+    if (new_size > capacity_) {
+      reserve(std::max(new_size, capacity_ * 2));
+    }
+  }
+
+  constexpr auto erase_range(size_type const first, size_type const last) {
+    auto const count = last - first;
+    template for (constexpr auto member: column_members()) {
+      auto* const column = columns_.[:member:];
+      std::move(column + last, column + size_, column + first);
+      std::destroy(column + size_ - count, column + size_);
+    }
+    size_ -= count;
+    return begin() + static_cast<std::ptrdiff_t>(first);
+  }
+
+  constexpr void deallocate() noexcept {
+    if (buffer_ != nullptr) {
+      std::allocator_traits<allocator_type>::deallocate(alloc_, buffer_, buffer_bytes(capacity_) / column_alignment);
+    }
+  }
+
+  constexpr void release() noexcept {
+    clear();
+    deallocate();
+  }
+
+  static constexpr auto members_count =
+      (nonstatic_data_members_of(^^T, std::meta::access_context::unchecked())).size();
+
+  [[no_unique_address]] allocator_type alloc_ {};
+  detail::column_block* buffer_ {};
+  struct_of_pointers<T> columns_ {};
+  size_type size_ {};
+  size_type capacity_ {};
+};
+
+} // namespace rflect
@@ -0,0 +1,161 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file projection.hpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Member subset views over structure of arrays containers
+ *
+ * `project<&T::a, &T::b>(container)` views only the columns of the named
+ * members, so iterating it carries two base pointers instead of one per
+ * member of `T`
+ */
+
+#pragma once
+
+#include <rflect/concepts/layout_concepts.hpp>
+#include <rflect/containers/iterator.hpp>
+#include <rflect/converters/soa_to_zip.hpp>
+#include <rflect/converters/struct_to_soa.hpp>
+#include <rflect/converters/to_static.hpp>
+#include <rflect/introspection/struct.hpp>
+
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <utility>
+
+namespace rflect {
+
+/**
+ * @brief Non owning random access view over the columns of some members of a structure of arrays container.
+ *
+ * Holds one `std::span` per selected member, in declaration order within `T` (see `struct_with`), and nothing about
+ * the other columns. Iterating it yields `T`'s proxies whose container is the view, so the accessors of the selected
+ * members work as usual (`particle.position()`) and the others do not compile. `to_zip()` zips only the selected
+ * columns, for algorithms working on reference tuples, and `spans()` hands the columns themselves to hot loops.
+ *
+ * The elements of the view are only the selected members, so its `value_type` is `struct_with<T, Members...>`: that is
+ * what proxies convert to, and what `iter_move` and `swap` copy, so permuting algorithms such as `std::ranges::reverse`
+ * move the selected columns and leave the others untouched.
+ *
+ * Like `std::span`, the view does not own the columns: it is invalidated by anything that reallocates the container.
+ *
+ * @tparam T Element type, const qualified for read only views
+ * @tparam Members Pointers to the selected data members (e.g. `&T::member`)
+ */
+template<typename T, auto... Members>
+class projection_view : public std::ranges::view_interface<projection_view<T, Members...>> {
+public:
+  /**********************************
+   *          Member types          *
+   **********************************/
+  using element_type         = std::remove_const_t<T>;
+  using members_type         = struct_with<element_type, Members...>;
+  using value_type           = members_type;
+  using memory_layout        = layout::soa;
+  using underlying_container = projection_view;
+  using spans_type = struct_of_spans<std::conditional_t<std::is_const_v<T>, members_type const, members_type>>;
+  using size_type  = std::size_t;
+
+  // ********* Constructors *********
+
+  constexpr projection_view() = default;
+
+  constexpr explicit projection_view(spans_type const& spans) : spans_(spans) { }
+
+  // ********** Element access **********
+
+  /**
+   * Reference tuple to the selected members of the element at `index`
+   */
+  constexpr auto at(size_type const index) const {
+    return [&]<std::size_t... I>(std::index_sequence<I...>) {
+      return std::tie(spans_.[:nonstatic_data_member<spans_type>(I):][index]...);
+    }(std::make_index_sequence<members_count>());
+  }
+
+  /**
+   * Proxy to the element at `index`, for types declaring one with `DEFINE_PROXY`
+   */
+  constexpr auto operator[](size_type const index) const
+    requires requires { typename element_type::template proxy_type<projection_view const>; }
+  {
+    return typename element_type::template proxy_type<projection_view const> {*this, index};
+  }
+
+  template<std::size_t I>
+  constexpr auto items() const {
+    return spans_.[:nonstatic_data_member<spans_type>(I):];
+  }
+
+  template<char const* name>
+  constexpr auto items() const {
+    return spans_.[:nonstatic_data_member<spans_type>(name):];
+  }
+
+  [[nodiscard]] constexpr spans_type const& spans() const noexcept { return spans_; }
+
+  constexpr auto to_zip() const { return soa_to_zip(spans_); }
+
+  // ********* Iterators *********
+
+  constexpr auto begin() const
+    requires requires { typename element_type::template proxy_type<projection_view const>; }
+  {
+    return proxy_iterator<typename element_type::template proxy_type<projection_view const>> {*this, 0};
+  }
+
+  constexpr auto end() const
+    requires requires { typename element_type::template proxy_type<projection_view const>; }
+  {
+    return proxy_iterator<typename element_type::template proxy_type<projection_view const>> {*this, size()};
+  }
+
+  // ********* Capacity *********
+
+  [[nodiscard]] constexpr size_type size() const noexcept { return items<0>().size(); }
+
+private:
+  static constexpr auto members_count =
+      (nonstatic_data_members_of(^^spans_type, std::meta::access_context::unchecked())).size();
+
+  spans_type spans_ {};
+};
+
+/**
+ * @brief Views the columns of `Members` in a structure of arrays container, leaving the other columns out.
+ *
+ * ```cpp
+ * for (auto particle: rflect::project<&Particle::position, &Particle::velocity>(block.particles)) {
+ *   particle.position() += particle.velocity() * time_step;
+ * }
+ * ```
+ *
+ * Works with any container exposing its columns by name through `items<name>()`: `dual_vector` in structure of
+ * arrays layouts, `multi_vector`, `packed_multi_vector`, `small_multi_vector` or `static_multi_vector`. Projecting a
+ * const container gives a read only view.
+ *
+ * @tparam Members Pointers to the data members to keep (e.g. `&T::member`)
+ * @param container Container whose columns are viewed
+ */
+template<auto... Members, typename Container>
+  requires(sizeof...(Members) > 0)
+constexpr auto project(Container& container) {
+  using value_type = typename std::remove_const_t<Container>::value_type;
+  using view_type  = projection_view<std::conditional_t<std::is_const_v<Container>, value_type const, value_type>,
+                                     Members...>;
+  using spans_type = typename view_type::spans_type;
+
+  spans_type spans {};
+  template for (constexpr auto member:
+                nonstatic_data_members_of(^^spans_type, std::meta::access_context::unchecked()) | to_static_array) {
+    constexpr auto name = std::define_static_string(identifier_of(member));
+    spans.[:member:]    = std::span(container.template items<name>());
+  }
+  return view_type(spans);
+}
+
+} // namespace rflect
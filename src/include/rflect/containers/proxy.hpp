@@ -16,6 +16,9 @@
 #include <rflect/converters/soa_to_zip.hpp>
 #include "rflect/concepts/layout_concepts.hpp"
 
+#include <tuple>
+#include <utility>
+
 namespace rflect {
 
 /**
@@ -102,21 +105,21 @@ public:
   constexpr ~proxy_base() = default;
 
   // *** Operators ***
-  constexpr proxy_type& operator=(proxy_base&& other) noexcept {
-    container_ = other.container_;
-    index_     = other.index_;
-    return static_cast<proxy_type&>(*this);
-  }
+  /**
+   * Assignments write through to the referenced element and never rebind the proxy, so they are const qualified and
+   * `*out = *in` copies one element as it would with language references
+   */
+  constexpr proxy_type const& operator=(proxy_base&& other) const { return *this = std::as_const(other); }
 
-  constexpr proxy_type& operator=(value_type const& value)
+  constexpr proxy_type const& operator=(value_type const& value) const
     requires(aos_layout<container>)
   {
     container_.at(index_) = value;
-    return static_cast<proxy_type&>(*this);
+    return static_cast<proxy_type const&>(*this);
   }
 
 
-  constexpr proxy_type& operator=(value_type const& value)
+  constexpr proxy_type const& operator=(value_type const& value) const
     requires(soa_layout<container>)
   {
     template for (constexpr auto member:
@@ -124,37 +127,74 @@ public:
       constexpr auto identifier                          = std::define_static_string(identifier_of(member));
       container_.template items<identifier>().at(index_) = value.[:member:];
     }
-    return static_cast<proxy_type&>(*this);
+    return static_cast<proxy_type const&>(*this);
+  }
+
+  constexpr proxy_type const& operator=(value_type const& value) const
+    requires(gather_layout<container>)
+  {
+    container_.set(index_, value);
+    return static_cast<proxy_type const&>(*this);
   }
 
-  constexpr proxy_type& operator=(proxy_base const& value)
+  constexpr proxy_type const& operator=(proxy_base const& value) const
     requires(aos_layout<container>)
   {
     if (this != &value) {
       container_.at(index_) = *static_cast<proxy_type const&>(value);
     }
-    return static_cast<proxy_type&>(*this);
+    return static_cast<proxy_type const&>(*this);
   }
 
-  constexpr proxy_type& operator=(proxy_base const& value)
+  constexpr proxy_type const& operator=(proxy_base const& value) const
     requires(soa_layout<container>)
   {
     if (this == &value)
-      return static_cast<proxy_type&>(*this);
+      return static_cast<proxy_type const&>(*this);
 
     auto tuple = *static_cast<proxy_type const&>(value);
-    constexpr auto size =
-        (nonstatic_data_members_of(^^underlying_container, std::meta::access_context::unchecked()) | to_static_array)
-            .size();
+    constexpr auto size = std::tuple_size_v<decltype(tuple)>;
     template for (constexpr auto index: std::views::iota(0UZ, size)) {
-      container_.[:nonstatic_data_member<underlying_container>([:index:]):].at(index_) = std::get<([:index:])>(tuple);
+      container_.template items<index>().at(index_) = std::get<(index)>(tuple);
+    }
+    return static_cast<proxy_type const&>(*this);
+  }
+
+  constexpr proxy_type const& operator=(proxy_base const& value) const
+    requires(gather_layout<container>)
+  {
+    if (this != &value) {
+      container_.set(index_, *static_cast<proxy_type const&>(value));
+    }
+    return static_cast<proxy_type const&>(*this);
+  }
+
+  /**
+   * Copy of the referenced element, used by `iter_move` and by algorithms holding elements aside (e.g. the pivot of
+   * a sort)
+   */
+  constexpr operator value_type() const { // NOLINT: implicit, proxies convert to the referenced value
+    if constexpr (soa_layout<container>) {
+      return std::apply([](auto const&... members) { return value_type {members...}; }, container_.at(index_));
+    }
+    else {
+      return container_.at(index_);
     }
-    return static_cast<proxy_type&>(*this);
+  }
+
+  /**
+   * Swaps the referenced elements. Found through ADL by `std::iter_swap`, which swaps the prvalue proxies returned by
+   * `proxy_iterator`
+   */
+  friend constexpr void swap(proxy_type const& proxy1, proxy_type const& proxy2) {
+    value_type value = proxy1;
+    proxy1           = proxy2;
+    proxy2           = std::move(value);
   }
 
   template<typename Self>
   constexpr auto operator*(this Self&& self)
-    requires(aos_layout<container>)
+    requires(aos_layout<container> or gather_layout<container>)
   {
     return self.container_.at(self.index_);
   }
@@ -163,7 +203,7 @@ public:
   constexpr auto operator*(this Self&& self)
     requires(soa_layout<container>)
   {
-    return self.container_.to_zip()[self.index_];
+    return self.container_.at(self.index_);
   }
 
 protected:
@@ -179,6 +219,12 @@ protected:
     return (self.container_.template items<name>().at(self.index_));
   }
 
+  template<char const* name, typename Self>
+    requires(gather_layout<container>)
+  constexpr auto member(this Self&& self) -> decltype(auto) {
+    return (self.container_.template item<name>(self.index_));
+  }
+
 private:
   std::size_t index_;
   underlying_container& container_;
@@ -0,0 +1,294 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file slot_map.hpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Slot map with stable generational keys over a dual_vector
+ *
+ * Elements are kept densely packed in a dual_vector (SoA by default) and
+ * addressed through keys that survive the erasure of other elements
+ */
+
+#pragma once
+
+#include <rflect/concepts/layout_concepts.hpp>
+#include <rflect/concepts/proxy_concepts.hpp>
+#include <rflect/containers/dual_vector.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace rflect {
+
+/**
+ * @brief Stable handle to an element of a `slot_map`.
+ *
+ * `index` names a slot of the map and `generation` the occupant of that slot the key was issued for, so a key to an
+ * erased element never refers to the element that later reuses its slot.
+ */
+struct slot_key {
+  std::uint32_t index;
+  std::uint32_t generation;
+
+  friend constexpr bool operator==(slot_key const&, slot_key const&) = default;
+};
+
+/**
+ * @brief Unordered container with O(1) insertion, lookup and erasure through stable keys, and dense storage.
+ *
+ * Elements live packed at the front of a `dual_vector<T, Layout, Alloc>`, so iterating a structure of arrays slot map
+ * walks contiguous member columns (`items`, `spans`) with no holes, as entity-component systems want. `insert`
+ * returns a `slot_key` that stays valid until its element is erased, no matter how many other elements are inserted
+ * or erased. Erasure moves the last element into the hole (swap and pop), so it costs one element copy instead of
+ * shifting every column, and element order is not preserved.
+ *
+ * Keys go through a slot table: every slot holds the dense position of its element and a generation counter bumped on
+ * erasure, and free slots form an intrusive list reused by later insertions. A second table maps dense positions back
+ * to their slots to fix up the moved element.
+ *
+ * @tparam T Aggregate type with a proxy (see `DEFINE_PROXY`)
+ * @tparam Layout Memory layout of the dense storage
+ * @tparam Alloc Allocator template, used for the dense storage and both tables
+ */
+template<has_proxy T, memory_layout Layout = layout::soa, template<typename> class Alloc = std::allocator>
+class slot_map {
+  struct slot {
+    std::uint32_t position;   // Dense position while occupied, next free slot otherwise
+    std::uint32_t generation; // Bumped every time the occupant is erased
+  };
+
+public:
+  /**********************************
+   *          Member types          *
+   **********************************/
+  using value_type      = T;
+  using key_type        = slot_key;
+  using allocator_type  = Alloc<T>;
+  using container_type  = dual_vector<T, Layout, Alloc>;
+  using view_type       = typename container_type::view_type;
+  using const_view_type = typename container_type::const_view_type;
+  using memory_layout   = Layout;
+  using iterator        = typename container_type::iterator;
+  using const_iterator  = typename container_type::const_iterator;
+  using size_type       = std::size_t;
+
+  // ********* Constructors *********
+
+  constexpr slot_map() = default;
+
+  constexpr explicit slot_map(allocator_type const& alloc) :
+    dense_(alloc), keys_(Alloc<slot_key>(alloc)), slots_(Alloc<slot>(alloc)) { }
+
+  /**********************************
+   *        Member functions        *
+   **********************************/
+
+  // ********* Lookup *********
+
+  /**
+   * Whether `key` refers to an element still in the map
+   */
+  [[nodiscard]] constexpr bool contains(key_type const key) const noexcept {
+    return key.index < slots_.size() and slots_[key.index].generation == key.generation and
+           slots_[key.index].position < dense_.size() and keys_[slots_[key.index].position] == key;
+  }
+
+  /**
+   * Dense position of the element `key` refers to, which must be in the map. Positions change on erasure
+   */
+  [[nodiscard]] constexpr size_type index_of(key_type const key) const noexcept {
+    assert(contains(key));
+    return slots_[key.index].position;
+  }
+
+  /**
+   * Key of the element at dense position `index`
+   */
+  [[nodiscard]] constexpr key_type key_of(size_type const index) const noexcept { return keys_[index]; }
+
+  template<typename Self>
+  constexpr auto find(this Self& self, key_type const key) {
+    return self.contains(key) ? self.begin() + static_cast<std::ptrdiff_t>(self.index_of(key)) : self.end();
+  }
+
+  // ********* Element access *********
+
+  /**
+   * @throws std::out_of_range if `key` does not refer to an element of the map
+   */
+  template<typename Self>
+  constexpr auto at(this Self& self, key_type const key) {
+    if (not self.contains(key)) {
+      throw std::out_of_range("slot_map: invalid key");
+    }
+    return self.dense_[self.index_of(key)];
+  }
+
+  template<typename Self>
+  constexpr auto operator[](this Self& self, key_type const key) {
+    return self.dense_[self.index_of(key)];
+  }
+
+  /**
+   * Contiguous span over the column of member `name`, holding every element in dense order
+   */
+  template<char const* name, typename Self>
+    requires(soa_layout<Layout>)
+  constexpr auto items(this Self& self) {
+    return self.dense_.template items<name>();
+  }
+
+  template<typename Self>
+    requires(soa_layout<Layout>)
+  constexpr auto spans(this Self& self) {
+    return self.dense_.spans();
+  }
+
+  /**
+   * Dense storage, in the same order as `keys()`
+   */
+  [[nodiscard]] constexpr container_type const& values() const noexcept { return dense_; }
+
+  /**
+   * Key of every element, in dense order
+   */
+  [[nodiscard]] constexpr std::span<key_type const> keys() const noexcept { return keys_; }
+
+  // ********* Iterators *********
+
+  constexpr iterator begin() noexcept { return dense_.begin(); }
+
+  constexpr iterator end() noexcept { return dense_.end(); }
+
+  [[nodiscard]] constexpr const_iterator begin() const noexcept { return dense_.begin(); }
+
+  [[nodiscard]] constexpr const_iterator end() const noexcept { return dense_.end(); }
+
+  [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return dense_.cbegin(); }
+
+  [[nodiscard]] constexpr const_iterator cend() const noexcept { return dense_.cend(); }
+
+  // ********* Capacity *********
+
+  [[nodiscard]] constexpr bool empty() const noexcept { return dense_.empty(); }
+
+  [[nodiscard]] constexpr size_type size() const noexcept { return dense_.size(); }
+
+  [[nodiscard]] constexpr size_type capacity() const noexcept { return dense_.capacity(); }
+
+  constexpr void reserve(size_type const new_capacity) {
+    dense_.reserve(new_capacity);
+    keys_.reserve(new_capacity);
+    slots_.reserve(new_capacity);
+  }
+
+  // ********* Modifiers *********
+
+  /**
+   * Appends `item` to the dense storage, reusing the most recently freed slot if there is one. Strong exception
+   * guarantee: both tables are grown before the element is appended, so if any allocation or the copy of `item` throws
+   * the map is left unchanged
+   *
+   * @return Key to the new element
+   */
+  constexpr key_type insert(value_type const& item) {
+    assert(size() < std::numeric_limits<std::uint32_t>::max());
+    auto const position = static_cast<std::uint32_t>(dense_.size());
+
+    grow(keys_);
+    if (free_head_ == no_slot) {
+      grow(slots_);
+    }
+    dense_.push_back(item);
+
+    // Nothing below allocates
+    std::uint32_t index = free_head_;
+    if (index == no_slot) {
+      index = static_cast<std::uint32_t>(slots_.size());
+      slots_.push_back({.position = position, .generation = 0});
+    }
+    else {
+      free_head_             = slots_[index].position;
+      slots_[index].position = position;
+    }
+
+    key_type const key {.index = index, .generation = slots_[index].generation};
+    keys_.push_back(key);
+    return key;
+  }
+
+  /**
+   * Erases the element `key` refers to by moving the last element into its place. Invalidates `key`, iterators and
+   * dense positions, but no other key
+   *
+   * @return Whether `key` referred to an element of the map
+   */
+  constexpr bool erase(key_type const key) {
+    if (not contains(key)) {
+      return false;
+    }
+    auto const position = slots_[key.index].position;
+    auto const last     = static_cast<std::uint32_t>(dense_.size() - 1);
+    if (position != last) {
+      auto const moved = dense_[last];
+      dense_[position] = moved;
+      keys_[position]  = keys_[last];
+      slots_[keys_[position].index].position = position;
+    }
+    dense_.pop_back();
+    keys_.pop_back();
+    release(key.index);
+    return true;
+  }
+
+  /**
+   * Erases every element, invalidating all keys
+   */
+  constexpr void clear() {
+    for (auto const key: keys_) {
+      release(key.index);
+    }
+    dense_.resize(0);
+    keys_.clear();
+  }
+
+private:
+  /**
+   * Makes room for one more entry in `table` so the following `push_back` cannot throw. Grows geometrically, reserving
+   * exactly one more entry on every insertion would reallocate each time
+   */
+  template<typename Table>
+  static constexpr void grow(Table& table) {
+    if (table.size() == table.capacity()) {
+      table.reserve(std::max<size_type>(1, 2 * table.capacity()));
+    }
+  }
+
+  /**
+   * Pushes slot `index` onto the free list, invalidating the keys issued for its last occupant
+   */
+  constexpr void release(std::uint32_t const index) {
+    auto& freed    = slots_[index];
+    freed.position = free_head_;
+    ++freed.generation;
+    free_head_ = index;
+  }
+
+  static constexpr std::uint32_t no_slot = std::numeric_limits<std::uint32_t>::max();
+
+  container_type dense_ {};
+  std::vector<key_type, Alloc<key_type>> keys_ {};
+  std::vector<slot, Alloc<slot>> slots_ {};
+  std::uint32_t free_head_ = no_slot;
+};
+
+} // namespace rflect
@@ -0,0 +1,321 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file small_multi_vector.hpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Small buffer optimized multi vector class
+ *
+ * Structure of arrays container keeping its first N elements inline, in a
+ * structure of arrays, and moving to heap columns only beyond that
+ */
+
+#pragma once
+
+#include <rflect/containers/multi_vector.hpp>
+#include <rflect/containers/static_multi_vector.hpp>
+#include <rflect/converters/soa_to_zip.hpp>
+#include <rflect/converters/struct_to_soa.hpp>
+#include <rflect/converters/to_static.hpp>
+#include <rflect/introspection/struct.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace rflect {
+
+/**
+ * @brief Structure of arrays container with inline storage for up to `N` elements per column
+ *
+ * Same interface as `packed_multi_vector`. While the container holds at most `N` elements they live in a
+ * `static_multi_vector<T, N>` inside the object, so small containers (e.g. the particles of a grid cell) never touch
+ * the allocator. The first time it outgrows `N` all columns are moved to a `multi_vector` and the container stays
+ * there, like a `std::vector` that keeps its capacity. Columns are exposed as `std::span`s through `items()`.
+ *
+ * @tparam T Aggregate type to be converted, its members must be default constructible
+ * @tparam N Inline capacity, in elements per column
+ * @tparam Alloc Allocator type for the heap columns
+ */
+template<typename T, std::size_t N, template<typename> class Alloc = std::allocator>
+  requires(std::is_aggregate_v<T> and N > 0)
+class small_multi_vector {
+public:
+  /**********************************
+   *          Member types          *
+   **********************************/
+  using value_type           = T;
+  using allocator_type       = Alloc<T>;
+  using inline_container     = static_multi_vector<T, N>;
+  using heap_container       = multi_vector<T, Alloc>;
+  using underlying_container = struct_of_spans<T>;
+  using const_container      = struct_of_spans<T const>;
+  using iterator             = decltype(std::begin(std::declval<as_zip<underlying_container>>()));
+  using const_iterator       = decltype(std::begin(std::declval<as_zip<const_container>>()));
+  using size_type            = std::size_t;
+
+  static constexpr size_type inline_capacity = N;
+
+  // ********* Constructors *********
+
+  constexpr small_multi_vector() = default;
+
+  constexpr small_multi_vector(std::initializer_list<value_type> init) { append_range(init); }
+
+  constexpr explicit small_multi_vector(std::integral auto size) { resize(static_cast<size_type>(size)); }
+
+  /**
+   * `alloc` is only used once the container outgrows its inline storage
+   */
+  constexpr explicit small_multi_vector(allocator_type const& alloc) : heap_(alloc) { }
+
+  constexpr small_multi_vector(small_multi_vector const& other) = default;
+
+  constexpr small_multi_vector(small_multi_vector&& other) noexcept :
+    inline_(std::exchange(other.inline_, {})), heap_(std::move(other.heap_)),
+    on_heap_(std::exchange(other.on_heap_, false)) { }
+
+  constexpr small_multi_vector& operator=(small_multi_vector other) noexcept {
+    swap(other);
+    return *this;
+  }
+
+  /**********************************
+   *        Member functions        *
+   **********************************/
+
+  // ********** Element access **********
+
+  /**
+   * Reference tuple to the element at `index`, indexing every column directly instead of going through a zip view
+   */
+  template<typename Self>
+  constexpr auto at(this Self&& self, std::size_t const index) {
+    auto spans = self.spans();
+    return [&]<std::size_t... I>(std::index_sequence<I...>) {
+      return std::tie(spans.[:nonstatic_data_member<decltype(spans)>(I):][index]...);
+    }(std::make_index_sequence<members_count>());
+  }
+
+  template<typename Self>
+  constexpr auto operator[](this Self&& self, std::size_t const index) {
+    return self.at(index);
+  }
+
+  template<typename Self>
+  constexpr auto front(this Self&& self) {
+    return self.at(0);
+  }
+
+  template<typename Self>
+  constexpr auto back(this Self&& self) {
+    return self.at(self.size() - 1);
+  }
+
+  template<std::size_t I, typename Self>
+  constexpr auto items(this Self& self) {
+    auto spans = self.spans();
+    return spans.[:nonstatic_data_member<decltype(spans)>(I):];
+  }
+
+  template<char const* name, typename Self>
+  constexpr auto items(this Self& self) {
+    auto spans = self.spans();
+    return spans.[:nonstatic_data_member<decltype(spans)>(name):];
+  }
+
+  /**
+   * Non owning structure of spans over the first `size()` elements of every column, wherever they currently live.
+   * Spilling to the heap invalidates it, like any reallocation
+   */
+  template<typename Self>
+  constexpr auto spans(this Self& self) {
+    return self.on_heap_ ? self.heap_.spans() : self.inline_.spans();
+  }
+
+  template<typename Self>
+  constexpr auto to_zip(this Self& self) {
+    return soa_to_zip(self.spans());
+  }
+
+  /**
+   * Allocator of the heap columns
+   */
+  [[nodiscard]] constexpr allocator_type get_allocator() const noexcept { return heap_.get_allocator(); }
+
+  // ********* Iterators *********
+
+  template<typename Self>
+  constexpr auto begin(this Self& self) noexcept {
+    return std::begin(self.to_zip());
+  }
+
+  template<typename Self>
+  constexpr auto end(this Self& self) noexcept {
+    return std::end(self.to_zip());
+  }
+
+  constexpr const_iterator cbegin() const noexcept { return begin(); }
+
+  constexpr const_iterator cend() const noexcept { return end(); }
+
+  // ********* Modifiers *********
+
+  constexpr void push_back(value_type const& item) {
+    if (not on_heap_ and inline_.try_push_back(item)) {
+      return;
+    }
+    spill(2 * N);
+    heap_.push_back(item);
+  }
+
+  constexpr void push_back(auto const value) {
+    if (not on_heap_ and inline_.size() < N) {
+      inline_.push_back(value);
+      return;
+    }
+    spill(2 * N);
+    heap_.push_back(value);
+  }
+
+  constexpr void pop_back() {
+    if (on_heap_) {
+      heap_.pop_back();
+      return;
+    }
+    inline_.pop_back();
+  }
+
+  constexpr auto erase(iterator const it) {
+    auto const index = it - begin();
+    if (on_heap_) {
+      heap_.erase(heap_.begin() + index);
+    }
+    else {
+      inline_.erase(inline_.begin() + index);
+    }
+    return begin() + index;
+  }
+
+  constexpr auto erase(iterator const begin_it, iterator const end_it) {
+    auto const first = begin_it - begin();
+    auto const last  = end_it - begin();
+    if (on_heap_) {
+      heap_.erase(heap_.begin() + first, heap_.begin() + last);
+    }
+    else {
+      inline_.erase(inline_.begin() + first, inline_.begin() + last);
+    }
+    return begin() + first;
+  }
+
+  /**
+   * Appends every element of an AoS range, column by column. The container spills to the heap once if the range does
+   * not fit in the inline storage
+   */
+  template<std::ranges::forward_range R>
+    requires(std::convertible_to<std::ranges::range_reference_t<R>, value_type const&>)
+  constexpr void append_range(R&& range) {
+    auto const count = static_cast<size_type>(std::ranges::distance(range));
+    if (not on_heap_ and count <= N - inline_.size()) {
+      inline_.append_range(std::forward<R>(range));
+      return;
+    }
+    spill(size() + count);
+    heap_.append_range(std::forward<R>(range));
+  }
+
+  /**
+   * Inserts the AoS range [first, last) before `pos`. Elements are appended and then rotated into place
+   */
+  template<std::forward_iterator It>
+    requires(std::convertible_to<std::iter_reference_t<It>, value_type const&>)
+  constexpr auto insert(iterator const pos, It const first, It const last) {
+    auto const index    = static_cast<size_type>(pos - begin());
+    auto const old_size = size();
+    append_range(std::ranges::subrange(first, last));
+    auto const columns = spans();
+    template for (constexpr auto member:
+                  nonstatic_data_members_of(^^underlying_container, std::meta::access_context::unchecked()) |
+                      to_static_array) {
+      auto* const column = columns.[:member:].data();
+      std::rotate(column + index, column + old_size, column + size());
+    }
+    return begin() + static_cast<std::ptrdiff_t>(index);
+  }
+
+  constexpr void resize(size_type const new_size) {
+    if (not on_heap_ and new_size <= N) {
+      inline_.resize(new_size);
+      return;
+    }
+    spill(new_size);
+    heap_.resize(new_size);
+  }
+
+  constexpr void clear() noexcept {
+    if (on_heap_) {
+      heap_.resize(0);
+      return;
+    }
+    inline_.clear();
+  }
+
+  constexpr void swap(small_multi_vector& other) noexcept {
+    std::ranges::swap(inline_, other.inline_);
+    std::ranges::swap(heap_, other.heap_);
+    std::ranges::swap(on_heap_, other.on_heap_);
+  }
+
+  // ********* Capacity *********
+
+  [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+
+  [[nodiscard]] constexpr size_type size() const noexcept { return on_heap_ ? heap_.size() : inline_.size(); }
+
+  [[nodiscard]] constexpr size_type max_size() const noexcept { return heap_.max_size(); }
+
+  [[nodiscard]] constexpr size_type capacity() const noexcept { return on_heap_ ? heap_.capacity() : N; }
+
+  /**
+   * Whether the elements still live in the inline storage
+   */
+  [[nodiscard]] constexpr bool is_inline() const noexcept { return not on_heap_; }
+
+  constexpr void reserve(size_type const new_capacity) {
+    if (new_capacity > capacity()) {
+      spill(new_capacity);
+    }
+  }
+
+private:
+  /**
+   * Moves the inline elements to the heap columns, reserving room for `new_capacity` elements. Only reserves once the
+   * container is on the heap
+   */
+  constexpr void spill(size_type const new_capacity) {
+    if (on_heap_) {
+      heap_.reserve(new_capacity);
+      return;
+    }
+    heap_.reserve(std::max(new_capacity, inline_.size()));
+    template for (constexpr auto index: std::views::iota(0UZ, members_count)) {
+      auto const column = inline_.template items<index>();
+      auto& heap        = heap_.template items<index>();
+      heap.insert(heap.end(), std::make_move_iterator(column.begin()), std::make_move_iterator(column.end()));
+    }
+    inline_.clear();
+    on_heap_ = true;
+  }
+
+  static constexpr auto members_count =
+      (nonstatic_data_members_of(^^T, std::meta::access_context::unchecked())).size();
+
+  inline_container inline_ {};
+  heap_container heap_ {};
+  bool on_heap_ {};
+};
+
+} // namespace rflect
@@ -0,0 +1,354 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file soa_ring.hpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Lock-free ring buffer with structure of arrays slots
+ *
+ * Bounded single consumer queue whose slots are split into one column per
+ * member, so consumers pull batches and read one member across the whole
+ * batch contiguously
+ */
+
+#pragma once
+
+#include <rflect/concepts/layout_concepts.hpp>
+#include <rflect/converters/soa_to_zip.hpp>
+#include <rflect/converters/struct_to_soa.hpp>
+#include <rflect/converters/to_static.hpp>
+#include <rflect/introspection/for_each.hpp>
+#include <rflect/introspection/struct.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <tuple>
+#include <utility>
+
+namespace rflect {
+
+namespace ring {
+
+/**
+ * @brief A single thread pushes into the ring, slots are published by moving the tail index
+ */
+struct single_producer {};
+
+/**
+ * @brief Any number of threads push into the ring, slots are reserved on the tail index and published one by one
+ */
+struct multi_producer {};
+
+} // namespace ring
+
+/**
+ * @brief Lock-free bounded queue of `Capacity` elements stored as a structure of arrays.
+ *
+ * The slots are a `struct_of_arrays<T, Capacity>`, one column per member, and the ring hands them to its single
+ * consumer in batches: a `batch` is a contiguous run of published slots with one `std::span` per member, so a
+ * consumer interested in a few members reads only their columns instead of striding over whole records. Batches stop
+ * at the end of the columns, the slots past the wrap around come in the next one.
+ *
+ * Producers push a `T`, a tuple of members or a proxy (e.g. an element of a `dual_vector`) with `try_push`, which
+ * fails instead of blocking when the ring is full. The consumer calls `read_batch`, processes the batch and gives its
+ * slots back with `release`. With `ring::single_producer` the ring is a classic two index SPSC queue; with
+ * `ring::multi_producer` producers reserve slots with a CAS on the tail and every slot carries a sequence number
+ * telling the consumer whether it has been published yet.
+ *
+ * The producer and consumer indices live on separate cache lines. Members must be default constructible and copy
+ * assignable: slots are overwritten in place, never constructed or destroyed.
+ *
+ * @tparam T Aggregate type to be converted
+ * @tparam Capacity Number of slots, a power of two
+ * @tparam Producers `ring::single_producer` or `ring::multi_producer`
+ */
+template<typename T, std::size_t Capacity, typename Producers = ring::single_producer>
+  requires(std::is_aggregate_v<T> and std::has_single_bit(Capacity))
+class soa_ring {
+  static constexpr bool multi_producer = std::same_as<Producers, ring::multi_producer>;
+
+  static constexpr auto members_count =
+      (nonstatic_data_members_of(^^T, std::meta::access_context::unchecked())).size();
+
+  static constexpr std::size_t mask = Capacity - 1;
+
+public:
+  /**********************************
+   *          Member types          *
+   **********************************/
+  using value_type           = T;
+  using underlying_container = struct_of_arrays<T, Capacity>;
+  using size_type            = std::size_t;
+
+  /**
+   * @brief Contiguous run of published slots handed to the consumer, valid until it is released.
+   *
+   * Exposes the same column interface as the structure of arrays containers (`items`, `spans`, `at`, iteration over
+   * reference tuples), so it can be the container of `T`'s proxy: `batch[i]` returns a `T::proxy_type<batch const>`.
+   */
+  class batch {
+  public:
+    using value_type           = T;
+    using memory_layout        = layout::soa;
+    using underlying_container = batch;
+    using spans_type           = struct_of_spans<T const>;
+    using size_type            = std::size_t;
+
+    constexpr batch() = default;
+
+    // ********** Element access **********
+
+    constexpr auto at(size_type const index) const {
+      return [&]<std::size_t... I>(std::index_sequence<I...>) {
+        return std::tie(spans_.[:nonstatic_data_member<spans_type>(I):][index]...);
+      }(std::make_index_sequence<members_count>());
+    }
+
+    /**
+     * Proxy to the element at `index`, for types declaring one with `DEFINE_PROXY`
+     */
+    constexpr auto operator[](size_type const index) const
+      requires requires { typename T::template proxy_type<batch const>; }
+    {
+      return typename T::template proxy_type<batch const> {*this, index};
+    }
+
+    template<std::size_t I>
+    constexpr auto items() const {
+      return spans_.[:nonstatic_data_member<spans_type>(I):];
+    }
+
+    template<char const* name>
+    constexpr auto items() const {
+      return spans_.[:nonstatic_data_member<spans_type>(name):];
+    }
+
+    [[nodiscard]] constexpr spans_type const& spans() const noexcept { return spans_; }
+
+    constexpr auto to_zip() const { return soa_to_zip(spans_); }
+
+    // ********* Iterators *********
+
+    constexpr auto begin() const noexcept { return std::begin(to_zip()); }
+
+    constexpr auto end() const noexcept { return std::end(to_zip()); }
+
+    // ********* Capacity *********
+
+    [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+
+    [[nodiscard]] constexpr size_type size() const noexcept { return size_; }
+
+  private:
+    friend soa_ring;
+
+    constexpr batch(spans_type const& spans, size_type const position, size_type const size) :
+      spans_(spans), position_(position), size_(size) { }
+
+    spans_type spans_ {};
+    size_type position_ {};
+    size_type size_ {};
+  };
+
+  // ********* Constructors *********
+
+  soa_ring() {
+    if constexpr (multi_producer) {
+      for (size_type index = 0; index < Capacity; ++index) {
+        sequence_[index].store(index, std::memory_order_relaxed);
+      }
+    }
+  }
+
+  soa_ring(soa_ring const&) = delete;
+
+  soa_ring& operator=(soa_ring const&) = delete;
+
+  /**********************************
+   *        Member functions        *
+   **********************************/
+
+  // ********* Producers *********
+
+  /**
+   * Copies `item` into the next free slot and publishes it
+   *
+   * @return Whether there was a free slot
+   */
+  bool try_push(value_type const& item) {
+    return push_with([&](size_type const slot) {
+      template for (constexpr auto index: std::views::iota(0UZ, members_count)) {
+        data_.[:nonstatic_data_member<underlying_container>(index):][slot] =
+            item.[:nonstatic_data_member<value_type>(index):];
+      }
+    });
+  }
+
+  /**
+   * Pushes a tuple holding one value per member, like the reference tuples of structure of arrays containers
+   */
+  template<typename Tuple>
+    requires(std::tuple_size<std::remove_cvref_t<Tuple>>::value == members_count)
+  bool try_push(Tuple const& value) {
+    return push_with([&](size_type const slot) {
+      template for (constexpr auto index: std::views::iota(0UZ, members_count)) {
+        data_.[:nonstatic_data_member<underlying_container>(index):][slot] = std::get<(index)>(value);
+      }
+    });
+  }
+
+  /**
+   * Pushes the element a proxy refers to, whatever the layout of its container
+   */
+  template<typename Proxy>
+    requires requires { typename Proxy::proxy_type; }
+  bool try_push(Proxy const& proxy) {
+    return try_push(*proxy);
+  }
+
+  // ********* Consumer *********
+
+  /**
+   * Up to `max` published slots, starting at the oldest one. The batch is empty if nothing has been published and is
+   * cut short at the end of the columns and, with several producers, at the first slot still being written
+   */
+  [[nodiscard]] batch read_batch(size_type const max = Capacity) {
+    auto const head  = head_.load(std::memory_order_relaxed);
+    auto const first = head & mask;
+    auto const limit = std::min(max, Capacity - first);
+
+    size_type count = 0;
+    if constexpr (multi_producer) {
+      while (count < limit and sequence_[first + count].load(std::memory_order_acquire) == head + count + 1) {
+        ++count;
+      }
+    }
+    else {
+      if (cached_tail_ - head < limit) {
+        cached_tail_ = tail_.load(std::memory_order_acquire);
+      }
+      count = std::min(limit, cached_tail_ - head);
+    }
+
+    typename batch::spans_type spans {};
+    template for (constexpr auto index: std::views::iota(0UZ, members_count)) {
+      spans.[:nonstatic_data_member<typename batch::spans_type>(index):] =
+          std::span(data_.[:nonstatic_data_member<underlying_container>(index):]).subspan(first, count);
+    }
+    return batch(spans, head, count);
+  }
+
+  /**
+   * Hands the slots of `consumed` back to the producers. Batches must be released in the order they were read
+   */
+  void release(batch const& consumed) {
+    auto const head = head_.load(std::memory_order_relaxed);
+    assert(consumed.position_ == head);
+    if constexpr (multi_producer) {
+      for (size_type offset = 0; offset < consumed.size(); ++offset) {
+        sequence_[(head + offset) & mask].store(head + offset + Capacity, std::memory_order_release);
+      }
+    }
+    head_.store(head + consumed.size(), std::memory_order_release);
+  }
+
+  /**
+   * Copies the oldest element into `item` and releases its slot
+   *
+   * @return Whether there was an element to pop
+   */
+  bool try_pop(value_type& item) {
+    auto const popped = read_batch(1);
+    if (popped.empty()) {
+      return false;
+    }
+    template for (constexpr auto index: std::views::iota(0UZ, members_count)) {
+      item.[:nonstatic_data_member<value_type>(index):] = popped.template items<index>()[0];
+    }
+    release(popped);
+    return true;
+  }
+
+  // ********* Capacity *********
+
+  /**
+   * Number of reserved slots not yet released. Only a snapshot while other threads use the ring
+   */
+  [[nodiscard]] size_type size() const noexcept {
+    auto const head = head_.load(std::memory_order_acquire);
+    auto const tail = tail_.load(std::memory_order_acquire); // Loaded last, never behind head
+    return tail - head;
+  }
+
+  [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+  [[nodiscard]] static constexpr size_type capacity() noexcept { return Capacity; }
+
+private:
+  /**
+   * Reserves a slot, lets `write` fill its columns and publishes it
+   */
+  bool push_with(auto&& write) {
+    if constexpr (multi_producer) {
+      auto tail = tail_.load(std::memory_order_relaxed);
+      while (true) {
+        auto const sequence   = sequence_[tail & mask].load(std::memory_order_acquire);
+        auto const difference = static_cast<std::ptrdiff_t>(sequence - tail);
+        if (difference == 0) {
+          if (tail_.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed)) {
+            break;
+          }
+        }
+        else if (difference < 0) {
+          return false; // The slot still holds an element from the previous lap
+        }
+        else {
+          tail = tail_.load(std::memory_order_relaxed);
+        }
+      }
+      write(tail & mask);
+      sequence_[tail & mask].store(tail + 1, std::memory_order_release);
+    }
+    else {
+      auto const tail = tail_.load(std::memory_order_relaxed);
+      if (tail - cached_head_ == Capacity) {
+        cached_head_ = head_.load(std::memory_order_acquire);
+        if (tail - cached_head_ == Capacity) {
+          return false;
+        }
+      }
+      write(tail & mask);
+      tail_.store(tail + 1, std::memory_order_release);
+    }
+    return true;
+  }
+
+  struct no_sequence {};
+
+  using sequence_type =
+      std::conditional_t<multi_producer, std::array<std::atomic<size_type>, Capacity>, no_sequence>;
+
+  // Consumer side
+  alignas(detail::cache_line_size) std::atomic<size_type> head_ {};
+  size_type cached_tail_ {};
+
+  // Producer side
+  alignas(detail::cache_line_size) std::atomic<size_type> tail_ {};
+  size_type cached_head_ {};
+
+  alignas(detail::cache_line_size) underlying_container data_ {};
+  [[no_unique_address]] sequence_type sequence_ {};
+};
+
+/**
+ * @brief `soa_ring` accepting pushes from several threads
+ */
+template<typename T, std::size_t Capacity>
+using mpsc_soa_ring = soa_ring<T, Capacity, ring::multi_producer>;
+
+} // namespace rflect
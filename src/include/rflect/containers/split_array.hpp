@@ -0,0 +1,178 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file split_array.hpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Split array class
+ *
+ * Fixed size array storing the hot members of an aggregate as a structure
+ * of arrays and the cold ones as an array of structures
+ */
+#pragma once
+
+#include <rflect/containers/gather_iterator.hpp>
+#include <rflect/containers/multi_array.hpp>
+#include <rflect/converters/struct_to_soa.hpp>
+#include <rflect/converters/to_static.hpp>
+#include <rflect/introspection/struct.hpp>
+
+#include <array>
+#include <span>
+#include <string_view>
+
+namespace rflect {
+
+namespace detail {
+
+/**
+ * Whether `name` designates one of the `Hot` members of `T`
+ */
+template<typename T, auto... Hot>
+consteval bool is_hot_member(std::string_view const name) {
+  return ((identifier_of(nonstatic_data_member<T>(Hot)) == name) or ...);
+}
+
+/**
+ * Copies the members of `value` kept by `Part` (a `struct_with`/`struct_without` of `T`)
+ */
+template<typename Part, typename T>
+constexpr Part slice(T const& value) {
+  Part part {};
+  template for (constexpr auto member:
+                nonstatic_data_members_of(^^Part, std::meta::access_context::unchecked()) | to_static_array) {
+    part.[:member:] = value.[:nonstatic_data_member<T>(identifier_of(member)):];
+  }
+  return part;
+}
+
+} // namespace detail
+
+/**
+ * @brief Fixed size container storing the hot members of an aggregate type as a structure of arrays and the rest
+ * of them as an array of structures.
+ *
+ * Hot members live in a `multi_array<struct_with<T, Hot...>, N>`, so loops touching only them stream dense columns.
+ * Cold members stay together in a `std::array<struct_without<T, Hot...>, N>` indexed like the hot columns.
+ *
+ * @tparam T Aggregate type to be stored
+ * @tparam N Number of elements
+ * @tparam Hot Pointers to the hot data members of `T` (e.g. `&T::position`)
+ */
+template<typename T, std::size_t N, auto... Hot>
+  requires(std::is_aggregate_v<T> and sizeof...(Hot) > 0)
+class split_array {
+public:
+  /**********************************
+   *          Member types          *
+   **********************************/
+  using value_type     = T;
+  using hot_type       = struct_with<T, Hot...>;
+  using cold_type      = struct_without<T, Hot...>;
+  using hot_container  = multi_array<hot_type, N>;
+  using cold_container = std::array<cold_type, N>;
+  using iterator       = detail::gather_iterator<split_array>;
+  using const_iterator = detail::gather_iterator<split_array const>;
+  using size_type      = std::size_t;
+
+  /**********************************
+   *        Member functions        *
+   **********************************/
+
+  // ********* Constructors *********
+
+  constexpr split_array() = default;
+
+  constexpr split_array(std::initializer_list<value_type> init) {
+    for (size_type i = 0; auto const& item: init) {
+      set(i++, item);
+    }
+  }
+
+  // ********* Element access *********
+
+  [[nodiscard]] constexpr value_type at(size_type const index) const {
+    value_type value {};
+    template for (constexpr auto member:
+                  nonstatic_data_members_of(^^value_type, std::meta::access_context::unchecked()) | to_static_array) {
+      constexpr auto identifier = std::define_static_string(identifier_of(member));
+      value.[:member:]          = item<identifier>(index);
+    }
+    return value;
+  }
+
+  [[nodiscard]] constexpr value_type operator[](size_type const index) const { return at(index); }
+
+  [[nodiscard]] constexpr value_type front() const { return at(0); }
+
+  [[nodiscard]] constexpr value_type back() const { return at(size() - 1); }
+
+  template<char const* name, typename Self>
+  constexpr decltype(auto) item(this Self& self, size_type const index) {
+    if constexpr (detail::is_hot_member<T, Hot...>(name)) {
+      return (self.hot_.template items<name>()[index]);
+    }
+    else {
+      return (self.cold_[index].[:nonstatic_data_member<cold_type>(name):]);
+    }
+  }
+
+  /**
+   * Contiguous span over the column of the hot member `name`
+   */
+  template<char const* name, typename Self>
+    requires(detail::is_hot_member<T, Hot...>(name))
+  constexpr auto items(this Self& self) {
+    return std::span(self.hot_.template items<name>());
+  }
+
+  template<typename Self>
+  constexpr auto& hot(this Self& self) {
+    return self.hot_;
+  }
+
+  template<typename Self>
+  constexpr auto cold(this Self& self) {
+    return std::span(self.cold_);
+  }
+
+  // ********* Modifiers *********
+
+  constexpr void set(size_type const index, value_type const& value) {
+    template for (constexpr auto member:
+                  nonstatic_data_members_of(^^value_type, std::meta::access_context::unchecked()) | to_static_array) {
+      constexpr auto identifier = std::define_static_string(identifier_of(member));
+      item<identifier>(index)   = value.[:member:];
+    }
+  }
+
+  // ********* Iterators *********
+
+  constexpr iterator begin() noexcept { return {*this, 0}; }
+
+  constexpr iterator end() noexcept { return {*this, size()}; }
+
+  [[nodiscard]] constexpr const_iterator begin() const noexcept { return {*this, 0}; }
+
+  [[nodiscard]] constexpr const_iterator end() const noexcept { return {*this, size()}; }
+
+  [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return {*this, 0}; }
+
+  [[nodiscard]] constexpr const_iterator cend() const noexcept { return {*this, size()}; }
+
+  // ********* Capacity *********
+
+  [[nodiscard]] constexpr size_type size() const noexcept { return N; }
+
+  [[nodiscard]] constexpr size_type max_size() const noexcept { return N; }
+
+  [[nodiscard]] constexpr bool empty() const noexcept { return N == 0; }
+
+private:
+  hot_container hot_ {};
+  cold_container cold_ {};
+};
+
+} // namespace rflect
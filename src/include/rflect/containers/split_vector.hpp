@@ -0,0 +1,238 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file split_vector.hpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Split vector class
+ *
+ * Dynamic array storing the hot members of an aggregate as a structure
+ * of arrays and the cold ones as an array of structures
+ */
+#pragma once
+
+#include <rflect/containers/multi_vector.hpp>
+#include <rflect/containers/split_array.hpp>
+
+#include <algorithm>
+#include <ranges>
+#include <vector>
+
+namespace rflect {
+
+/**
+ * @brief Dynamic container storing the hot members of an aggregate type as a structure of arrays and the rest of
+ * them as an array of structures.
+ *
+ * Hot members live in a `multi_vector<struct_with<T, Hot...>>`, cold members in a
+ * `std::vector<struct_without<T, Hot...>>`. Both sides always hold `size()` elements, the element `i` being made of
+ * the `i`-th entry of every hot column and the `i`-th cold structure.
+ *
+ * @tparam T Aggregate type to be stored
+ * @tparam Alloc Allocator type for the hot columns and the cold vector
+ * @tparam Hot Pointers to the hot data members of `T` (e.g. `&T::position`)
+ */
+template<typename T, template<typename> class Alloc, auto... Hot>
+  requires(std::is_aggregate_v<T> and sizeof...(Hot) > 0)
+class split_vector {
+public:
+  /**********************************
+   *          Member types          *
+   **********************************/
+  using value_type     = T;
+  using hot_type       = struct_with<T, Hot...>;
+  using cold_type      = struct_without<T, Hot...>;
+  using hot_container  = multi_vector<hot_type, Alloc>;
+  using cold_container = std::vector<cold_type, Alloc<cold_type>>;
+  using iterator       = detail::gather_iterator<split_vector>;
+  using const_iterator = detail::gather_iterator<split_vector const>;
+  using size_type      = std::size_t;
+
+  /**********************************
+   *        Member functions        *
+   **********************************/
+
+  // ********* Constructors *********
+
+  constexpr split_vector() = default;
+
+  constexpr split_vector(std::initializer_list<value_type> init) { append_range(init); }
+
+  constexpr explicit split_vector(std::integral auto size) : hot_(size), cold_(static_cast<size_type>(size)) { }
+
+  /**
+   * Hot columns and the cold vector share `alloc`, each one rebinding it to its element type
+   */
+  constexpr explicit split_vector(Alloc<T> const& alloc) :
+    hot_(typename hot_container::allocator_type(alloc)), cold_(typename cold_container::allocator_type(alloc)) { }
+
+  // ********* Element access *********
+
+  [[nodiscard]] constexpr value_type at(size_type const index) const {
+    value_type value {};
+    template for (constexpr auto member:
+                  nonstatic_data_members_of(^^value_type, std::meta::access_context::unchecked()) | to_static_array) {
+      constexpr auto identifier = std::define_static_string(identifier_of(member));
+      value.[:member:]          = item<identifier>(index);
+    }
+    return value;
+  }
+
+  [[nodiscard]] constexpr value_type operator[](size_type const index) const { return at(index); }
+
+  [[nodiscard]] constexpr value_type front() const { return at(0); }
+
+  [[nodiscard]] constexpr value_type back() const { return at(size() - 1); }
+
+  template<char const* name, typename Self>
+  constexpr decltype(auto) item(this Self& self, size_type const index) {
+    if constexpr (detail::is_hot_member<T, Hot...>(name)) {
+      return (self.hot_.template items<name>()[index]);
+    }
+    else {
+      return (self.cold_[index].[:nonstatic_data_member<cold_type>(name):]);
+    }
+  }
+
+  /**
+   * Contiguous span over the column of the hot member `name`. Like iterators it is invalidated by any operation that
+   * grows or shrinks the container
+   */
+  template<char const* name, typename Self>
+    requires(detail::is_hot_member<T, Hot...>(name))
+  constexpr auto items(this Self& self) {
+    return std::span(self.hot_.template items<name>());
+  }
+
+  template<typename Self>
+  constexpr auto& hot(this Self& self) {
+    return self.hot_;
+  }
+
+  template<typename Self>
+  constexpr auto cold(this Self& self) {
+    return std::span(self.cold_);
+  }
+
+  // ********* Iterators *********
+
+  constexpr iterator begin() noexcept { return {*this, 0}; }
+
+  constexpr iterator end() noexcept { return {*this, size()}; }
+
+  [[nodiscard]] constexpr const_iterator begin() const noexcept { return {*this, 0}; }
+
+  [[nodiscard]] constexpr const_iterator end() const noexcept { return {*this, size()}; }
+
+  [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return {*this, 0}; }
+
+  [[nodiscard]] constexpr const_iterator cend() const noexcept { return {*this, size()}; }
+
+  // ********* Modifiers *********
+
+  constexpr void set(size_type const index, value_type const& value) {
+    template for (constexpr auto member:
+                  nonstatic_data_members_of(^^value_type, std::meta::access_context::unchecked()) | to_static_array) {
+      constexpr auto identifier = std::define_static_string(identifier_of(member));
+      item<identifier>(index)   = value.[:member:];
+    }
+  }
+
+  constexpr void push_back(value_type const& item) {
+    hot_.push_back(detail::slice<hot_type>(item));
+    cold_.push_back(detail::slice<cold_type>(item));
+  }
+
+  constexpr void pop_back() {
+    hot_.pop_back();
+    cold_.pop_back();
+  }
+
+  constexpr iterator erase(iterator const it) {
+    auto const diff = it - begin();
+    hot_.erase(hot_.begin() + diff);
+    cold_.erase(cold_.begin() + diff);
+    return begin() + diff;
+  }
+
+  constexpr iterator erase(const_iterator const it) {
+    auto const diff = it - cbegin();
+    hot_.erase(hot_.begin() + diff);
+    cold_.erase(cold_.begin() + diff);
+    return begin() + diff;
+  }
+
+  constexpr iterator erase(iterator const begin_it, iterator const end_it) {
+    auto const first = begin_it - begin();
+    auto const last  = end_it - begin();
+    hot_.erase(hot_.begin() + first, hot_.begin() + last);
+    cold_.erase(cold_.begin() + first, cold_.begin() + last);
+    return begin() + first;
+  }
+
+  /**
+   * Appends a range of `value_type`. Every hot column grows once and is written sequentially, cold members are
+   * appended as whole structures
+   */
+  template<std::ranges::forward_range R>
+    requires(std::convertible_to<std::ranges::range_reference_t<R>, value_type const&>)
+  constexpr void append_range(R&& range) {
+    template for (constexpr auto member:
+                  nonstatic_data_members_of(^^hot_type, std::meta::access_context::unchecked()) | to_static_array) {
+      constexpr auto identifier = std::define_static_string(identifier_of(member));
+      hot_.template items<identifier>().append_range(range | project<identifier>);
+    }
+    cold_.append_range(range | project_cold);
+  }
+
+  template<std::forward_iterator It>
+    requires(std::convertible_to<std::iter_reference_t<It>, value_type const&>)
+  constexpr iterator insert(iterator const pos, It const first, It const last) {
+    auto const diff  = pos - begin();
+    auto const range = std::ranges::subrange(first, last);
+    template for (constexpr auto member:
+                  nonstatic_data_members_of(^^hot_type, std::meta::access_context::unchecked()) | to_static_array) {
+      constexpr auto identifier = std::define_static_string(identifier_of(member));
+      auto& column              = hot_.template items<identifier>();
+      column.insert_range(column.begin() + diff, range | project<identifier>);
+    }
+    cold_.insert_range(cold_.begin() + diff, range | project_cold);
+    return begin() + diff;
+  }
+
+  constexpr void resize(size_type const new_size) {
+    hot_.resize(new_size);
+    cold_.resize(new_size);
+  }
+
+  // ********* Capacity *********
+
+  [[nodiscard]] constexpr bool empty() const noexcept { return cold_.empty(); }
+
+  [[nodiscard]] constexpr size_type size() const noexcept { return cold_.size(); }
+
+  [[nodiscard]] constexpr size_type max_size() const noexcept { return std::min(hot_.max_size(), cold_.max_size()); }
+
+  [[nodiscard]] constexpr size_type capacity() const noexcept { return std::min(hot_.capacity(), cold_.capacity()); }
+
+  constexpr void reserve(size_type const new_capacity) {
+    hot_.reserve(new_capacity);
+    cold_.reserve(new_capacity);
+  }
+
+private:
+  // Projects an element onto a copy of its member `name` (copies, the range may yield prvalues)
+  template<char const* name>
+  static constexpr auto project = std::views::transform([](value_type const& item) {
+    return item.[:nonstatic_data_member<value_type>(name):];
+  });
+
+  static constexpr auto project_cold = std::views::transform(detail::slice<cold_type, value_type>);
+
+  hot_container hot_ {};
+  cold_container cold_ {};
+};
+
+} // namespace rflect
@@ -0,0 +1,321 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file static_multi_vector.hpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Fixed capacity multi vector class
+ *
+ * Structure of arrays analogue of `std::inplace_vector`: a runtime size
+ * over `struct_of_arrays` storage, never allocating
+ */
+
+#pragma once
+
+#include <rflect/converters/soa_to_zip.hpp>
+#include <rflect/converters/struct_to_soa.hpp>
+#include <rflect/converters/to_static.hpp>
+#include <rflect/introspection/struct.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <new>
+#include <utility>
+
+namespace rflect {
+
+/**
+ * @brief Structure of arrays container with a fixed capacity of `N` elements and no heap allocation
+ *
+ * Every column is a `std::array<Member, N>` inside the object and the container tracks how many of them are in use,
+ * like `std::inplace_vector`. Growing past `N` throws `std::bad_alloc` (`push_back`, `append_range`, `insert`,
+ * `resize`), `try_push_back` reports it instead and `unchecked_push_back` leaves it as a precondition. Every operation
+ * is constexpr. Columns are exposed as `std::span`s over the live elements through `items()`.
+ *
+ * Unlike `std::inplace_vector` the columns are arrays of constructed objects, so members must be default
+ * constructible: unused slots hold value initialized members, and removed elements are reset to that state.
+ *
+ * @tparam T Aggregate type to be converted
+ * @tparam N Capacity, in elements per column
+ */
+template<typename T, std::size_t N>
+  requires(std::is_aggregate_v<T>)
+class static_multi_vector {
+public:
+  /**********************************
+   *          Member types          *
+   **********************************/
+  using value_type           = T;
+  using underlying_container = struct_of_arrays<T, N>;
+  using spans_type           = struct_of_spans<T>;
+  using const_spans_type     = struct_of_spans<T const>;
+  using iterator             = decltype(std::begin(std::declval<as_zip<spans_type>>()));
+  using const_iterator       = decltype(std::begin(std::declval<as_zip<const_spans_type>>()));
+  using size_type            = std::size_t;
+
+  // ********* Constructors *********
+
+  constexpr static_multi_vector() = default;
+
+  constexpr static_multi_vector(std::initializer_list<value_type> init) { append_range(init); }
+
+  constexpr explicit static_multi_vector(std::integral auto size) { resize(static_cast<size_type>(size)); }
+
+  /**********************************
+   *        Member functions        *
+   **********************************/
+
+  // ********** Element access **********
+
+  /**
+   * Reference tuple to the element at `index`, indexing every column directly instead of going through a zip view
+   */
+  template<typename Self>
+  constexpr auto at(this Self& self, std::size_t const index) {
+    return [&]<std::size_t... I>(std::index_sequence<I...>) {
+      return std::tie(self.data_.[:nonstatic_data_member<underlying_container>(I):][index]...);
+    }(std::make_index_sequence<members_count>());
+  }
+
+  template<typename Self>
+  constexpr auto operator[](this Self& self, std::size_t const index) {
+    return self.at(index);
+  }
+
+  template<typename Self>
+  constexpr auto front(this Self& self) {
+    return self.at(0);
+  }
+
+  template<typename Self>
+  constexpr auto back(this Self& self) {
+    return self.at(self.size_ - 1);
+  }
+
+  template<std::size_t I, typename Self>
+  constexpr auto items(this Self& self) {
+    return std::span(self.data_.[:nonstatic_data_member<underlying_container>(I):]).first(self.size_);
+  }
+
+  template<char const* name, typename Self>
+  constexpr auto items(this Self& self) {
+    return std::span(self.data_.[:nonstatic_data_member<underlying_container>(name):]).first(self.size_);
+  }
+
+  /**
+   * Non owning structure of spans over the first `size()` elements of every column
+   */
+  template<typename Self>
+  constexpr auto spans(this Self& self) {
+    using result_type = std::conditional_t<std::is_const_v<Self>, const_spans_type, spans_type>;
+    result_type spans {};
+    template for (constexpr auto index: std::views::iota(0UZ, members_count)) {
+      spans.[:nonstatic_data_member<result_type>(index):] = self.template items<index>();
+    }
+    return spans;
+  }
+
+  template<typename Self>
+  constexpr auto to_zip(this Self& self) {
+    return soa_to_zip(self.spans());
+  }
+
+  // ********* Iterators *********
+
+  template<typename Self>
+  constexpr auto begin(this Self& self) noexcept {
+    return std::begin(self.to_zip());
+  }
+
+  template<typename Self>
+  constexpr auto end(this Self& self) noexcept {
+    return std::end(self.to_zip());
+  }
+
+  constexpr const_iterator cbegin() const noexcept { return begin(); }
+
+  constexpr const_iterator cend() const noexcept { return end(); }
+
+  // ********* Modifiers *********
+
+  /**
+   * @throws std::bad_alloc if the container is full
+   */
+  constexpr void push_back(value_type const& item) {
+    if (size_ == N) {
+      throw std::bad_alloc();
+    }
+    unchecked_push_back(item);
+  }
+
+  constexpr void push_back(auto const value) {
+    if (size_ == N) {
+      throw std::bad_alloc();
+    }
+    template for (constexpr auto index: std::views::iota(0UZ, members_count)) {
+      data_.[:nonstatic_data_member<underlying_container>(index):][size_] = std::get<(index)>(value);
+    }
+    ++size_;
+  }
+
+  /**
+   * Appends `item` if there is room left
+   *
+   * @return Whether `item` was appended
+   */
+  constexpr bool try_push_back(value_type const& item) {
+    if (size_ == N) {
+      return false;
+    }
+    unchecked_push_back(item);
+    return true;
+  }
+
+  /**
+   * Appends `item`, the container must not be full
+   */
+  constexpr void unchecked_push_back(value_type const& item) {
+    assert(size_ < N);
+    template for (constexpr auto index: std::views::iota(0UZ, members_count)) {
+      data_.[:nonstatic_data_member<underlying_container>(index):][size_] =
+          item.[:nonstatic_data_member<value_type>(index):];
+    }
+    ++size_;
+  }
+
+  constexpr void pop_back() {
+    --size_;
+    reset(size_, size_ + 1);
+  }
+
+  constexpr auto erase(iterator const it) {
+    auto const index = static_cast<size_type>(it - begin());
+    return erase_range(index, index + 1);
+  }
+
+  constexpr auto erase(iterator const begin_it, iterator const end_it) {
+    return erase_range(static_cast<size_type>(begin_it - begin()), static_cast<size_type>(end_it - begin()));
+  }
+
+  /**
+   * Appends every element of an AoS range, column by column
+   *
+   * @throws std::bad_alloc if the range does not fit, leaving the container unchanged
+   */
+  template<std::ranges::forward_range R>
+    requires(std::convertible_to<std::ranges::range_reference_t<R>, value_type const&>)
+  constexpr void append_range(R&& range) {
+    auto const count = static_cast<size_type>(std::ranges::distance(range));
+    if (count > N - size_) {
+      throw std::bad_alloc();
+    }
+    template for (constexpr auto index: std::views::iota(0UZ, members_count)) {
+      auto* const column = data_.[:nonstatic_data_member<underlying_container>(index):].data();
+      std::ranges::copy(range | project<index>, column + size_);
+    }
+    size_ += count;
+  }
+
+  /**
+   * Inserts the AoS range [first, last) before `pos`. Elements are appended and then rotated into place
+   *
+   * @throws std::bad_alloc if the range does not fit, leaving the container unchanged
+   */
+  template<std::forward_iterator It>
+    requires(std::convertible_to<std::iter_reference_t<It>, value_type const&>)
+  constexpr auto insert(iterator const pos, It const first, It const last) {
+    auto const index    = static_cast<size_type>(pos - begin());
+    auto const old_size = size_;
+    append_range(std::ranges::subrange(first, last));
+    template for (constexpr auto member:
+                  nonstatic_data_members_of(^^underlying_container, std::meta::access_context::unchecked()) |
+                      to_static_array) {
+      auto* const column = data_.[:member:].data();
+      std::rotate(column + index, column + old_size, column + size_);
+    }
+    return begin() + static_cast<std::ptrdiff_t>(index);
+  }
+
+  /**
+   * @throws std::bad_alloc if `new_size` is greater than `N`
+   */
+  constexpr void resize(size_type const new_size) {
+    if (new_size > N) {
+      throw std::bad_alloc();
+    }
+    reset(std::min(size_, new_size), std::max(size_, new_size));
+    size_ = new_size;
+  }
+
+  constexpr void clear() noexcept {
+    reset(0, size_);
+    size_ = 0;
+  }
+
+  constexpr void swap(static_multi_vector& other) noexcept {
+    std::ranges::swap(data_, other.data_);
+    std::ranges::swap(size_, other.size_);
+  }
+
+  // ********* Capacity *********
+
+  [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+
+  [[nodiscard]] constexpr size_type size() const noexcept { return size_; }
+
+  [[nodiscard]] static constexpr size_type max_size() noexcept { return N; }
+
+  [[nodiscard]] static constexpr size_type capacity() noexcept { return N; }
+
+  /**
+   * Does nothing, the capacity is fixed
+   *
+   * @throws std::bad_alloc if `new_capacity` is greater than `N`
+   */
+  static constexpr void reserve(size_type const new_capacity) {
+    if (new_capacity > N) {
+      throw std::bad_alloc();
+    }
+  }
+
+private:
+  // Projects an AoS element onto its I-th member
+  template<std::size_t I>
+  static constexpr auto project = std::views::transform([](value_type const& item) -> decltype(auto) {
+    return (item.[:nonstatic_data_member<value_type>(I):]);
+  });
+
+  /**
+   * Value initializes the slots in [first, last), releasing whatever the removed elements held
+   */
+  constexpr void reset(size_type const first, size_type const last) {
+    template for (constexpr auto member:
+                  nonstatic_data_members_of(^^underlying_container, std::meta::access_context::unchecked()) |
+                      to_static_array) {
+      auto* const column = data_.[:member:].data();
+      std::fill(column + first, column + last, std::remove_pointer_t<decltype(column)> {});
+    }
+  }
+
+  constexpr auto erase_range(size_type const first, size_type const last) {
+    template for (constexpr auto member:
+                  nonstatic_data_members_of(^^underlying_container, std::meta::access_context::unchecked()) |
+                      to_static_array) {
+      auto* const column = data_.[:member:].data();
+      std::move(column + last, column + size_, column + first);
+    }
+    reset(size_ - (last - first), size_);
+    size_ -= last - first;
+    return begin() + static_cast<std::ptrdiff_t>(first);
+  }
+
+  static constexpr auto members_count =
+      (nonstatic_data_members_of(^^T, std::meta::access_context::unchecked())).size();
+
+  underlying_container data_ {};
+  size_type size_ {};
+};
+
+} // namespace rflect
@@ -0,0 +1,130 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file tiled_array.hpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Tiled array class
+ *
+ * Fixed size array of structures of arrays (AoSoA). Elements are grouped in
+ * tiles of `Lanes` elements, inside a tile every member is stored contiguously
+ */
+#pragma once
+
+#include <rflect/containers/gather_iterator.hpp>
+#include <rflect/converters/struct_to_soa.hpp>
+#include <rflect/converters/to_static.hpp>
+#include <rflect/introspection/struct.hpp>
+
+#include <array>
+#include <span>
+
+namespace rflect {
+
+/**
+ * @brief Fixed size container storing an aggregate type in an Array of Structures of Arrays (AoSoA) layout.
+ *
+ * Every tile is a `struct_of_arrays<T, Lanes>`, so one member of `Lanes` consecutive elements is contiguous in
+ * memory (SIMD friendly) while all members of an element stay within the same tile (cache/TLB friendly).
+ *
+ * @tparam T Aggregate type to be stored
+ * @tparam N Number of elements
+ * @tparam Lanes Number of elements per tile
+ */
+template<typename T, std::size_t N, std::size_t Lanes>
+  requires(std::is_aggregate_v<T> and Lanes > 0)
+class tiled_array {
+public:
+  /**********************************
+   *          Member types          *
+   **********************************/
+  using value_type           = T;
+  using tile_type            = struct_of_arrays<T, Lanes>;
+  using underlying_container = std::array<tile_type, (N + Lanes - 1) / Lanes>;
+  using iterator             = detail::gather_iterator<tiled_array>;
+  using const_iterator       = detail::gather_iterator<tiled_array const>;
+  using size_type            = std::size_t;
+
+  static constexpr size_type lanes = Lanes;
+
+  /**********************************
+   *        Member functions        *
+   **********************************/
+
+  // ********* Constructors *********
+
+  constexpr tiled_array() = default;
+
+  constexpr tiled_array(std::initializer_list<value_type> init) {
+    for (size_type i = 0; auto const& item: init) {
+      set(i++, item);
+    }
+  }
+
+  // ********* Element access *********
+
+  [[nodiscard]] constexpr value_type at(size_type const index) const {
+    value_type value {};
+    auto const& tile = data_[index / Lanes];
+    template for (constexpr auto member:
+                  nonstatic_data_members_of(^^tile_type, std::meta::access_context::unchecked()) | to_static_array) {
+      value.[:nonstatic_data_member<value_type>(identifier_of(member)):] = tile.[:member:][index % Lanes];
+    }
+    return value;
+  }
+
+  [[nodiscard]] constexpr value_type operator[](size_type const index) const { return at(index); }
+
+  [[nodiscard]] constexpr value_type front() const { return at(0); }
+
+  [[nodiscard]] constexpr value_type back() const { return at(size() - 1); }
+
+  template<char const* name, typename Self>
+  constexpr decltype(auto) item(this Self& self, size_type const index) {
+    return (self.data_[index / Lanes].[:nonstatic_data_member<tile_type>(name):][index % Lanes]);
+  }
+
+  template<typename Self>
+  constexpr auto tiles(this Self& self) {
+    return std::span(self.data_);
+  }
+
+  // ********* Modifiers *********
+
+  constexpr void set(size_type const index, value_type const& value) {
+    auto& tile = data_[index / Lanes];
+    template for (constexpr auto member:
+                  nonstatic_data_members_of(^^tile_type, std::meta::access_context::unchecked()) | to_static_array) {
+      tile.[:member:][index % Lanes] = value.[:nonstatic_data_member<value_type>(identifier_of(member)):];
+    }
+  }
+
+  // ********* Iterators *********
+
+  constexpr iterator begin() noexcept { return {*this, 0}; }
+
+  constexpr iterator end() noexcept { return {*this, size()}; }
+
+  [[nodiscard]] constexpr const_iterator begin() const noexcept { return {*this, 0}; }
+
+  [[nodiscard]] constexpr const_iterator end() const noexcept { return {*this, size()}; }
+
+  [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return {*this, 0}; }
+
+  [[nodiscard]] constexpr const_iterator cend() const noexcept { return {*this, size()}; }
+
+  // ********* Capacity *********
+
+  [[nodiscard]] constexpr size_type size() const noexcept { return N; }
+
+  [[nodiscard]] constexpr size_type max_size() const noexcept { return N; }
+
+  [[nodiscard]] constexpr bool empty() const noexcept { return N == 0; }
+
+private:
+  underlying_container data_ {};
+};
+
+} // namespace rflect
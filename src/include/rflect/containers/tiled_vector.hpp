@@ -0,0 +1,224 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file tiled_vector.hpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Tiled vector class
+ *
+ * Dynamic array of structures of arrays (AoSoA). Elements are grouped in
+ * tiles of `Lanes` elements, inside a tile every member is stored contiguously
+ */
+#pragma once
+
+#include <rflect/containers/tiled_array.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace rflect {
+
+/**
+ * @brief Dynamic container storing an aggregate type in an Array of Structures of Arrays (AoSoA) layout.
+ *
+ * The container grows one tile (`struct_of_arrays<T, Lanes>`) at a time, the last tile may be partially filled.
+ * Lanes beyond `size()` hold unspecified values and are never read through the public interface.
+ *
+ * @tparam T Aggregate type to be stored
+ * @tparam Lanes Number of elements per tile
+ * @tparam Alloc Allocator type for the tile vector
+ */
+template<typename T, std::size_t Lanes, template<typename> class Alloc = std::allocator>
+  requires(std::is_aggregate_v<T> and Lanes > 0)
+class tiled_vector {
+public:
+  /**********************************
+   *          Member types          *
+   **********************************/
+  using value_type           = T;
+  using tile_type            = struct_of_arrays<T, Lanes>;
+  using underlying_container = std::vector<tile_type, Alloc<tile_type>>;
+  using iterator             = detail::gather_iterator<tiled_vector>;
+  using const_iterator       = detail::gather_iterator<tiled_vector const>;
+  using size_type            = std::size_t;
+
+  static constexpr size_type lanes = Lanes;
+
+  /**********************************
+   *        Member functions        *
+   **********************************/
+
+  // ********* Constructors *********
+
+  constexpr tiled_vector() = default;
+
+  constexpr tiled_vector(std::initializer_list<value_type> init) {
+    data_.reserve(tiles_for(init.size()));
+    for (auto const& item: init) {
+      push_back(item);
+    }
+  }
+
+  constexpr explicit tiled_vector(std::integral auto size) :
+    data_(tiles_for(static_cast<size_type>(size))), size_(static_cast<size_type>(size)) { }
+
+  constexpr explicit tiled_vector(Alloc<T> const& alloc) :
+    data_(typename underlying_container::allocator_type(alloc)) { }
+
+  // ********* Element access *********
+
+  [[nodiscard]] constexpr value_type at(size_type const index) const {
+    value_type value {};
+    auto const& tile = data_[index / Lanes];
+    template for (constexpr auto member:
+                  nonstatic_data_members_of(^^tile_type, std::meta::access_context::unchecked()) | to_static_array) {
+      value.[:nonstatic_data_member<value_type>(identifier_of(member)):] = tile.[:member:][index % Lanes];
+    }
+    return value;
+  }
+
+  [[nodiscard]] constexpr value_type operator[](size_type const index) const { return at(index); }
+
+  [[nodiscard]] constexpr value_type front() const { return at(0); }
+
+  [[nodiscard]] constexpr value_type back() const { return at(size_ - 1); }
+
+  template<char const* name, typename Self>
+  constexpr decltype(auto) item(this Self& self, size_type const index) {
+    return (self.data_[index / Lanes].[:nonstatic_data_member<tile_type>(name):][index % Lanes]);
+  }
+
+  template<typename Self>
+  constexpr auto tiles(this Self& self) {
+    return std::span(self.data_);
+  }
+
+  // ********* Iterators *********
+
+  constexpr iterator begin() noexcept { return {*this, 0}; }
+
+  constexpr iterator end() noexcept { return {*this, size_}; }
+
+  [[nodiscard]] constexpr const_iterator begin() const noexcept { return {*this, 0}; }
+
+  [[nodiscard]] constexpr const_iterator end() const noexcept { return {*this, size_}; }
+
+  [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return {*this, 0}; }
+
+  [[nodiscard]] constexpr const_iterator cend() const noexcept { return {*this, size_}; }
+
+  // ********* Modifiers *********
+
+  constexpr void set(size_type const index, value_type const& value) {
+    auto& tile = data_[index / Lanes];
+    template for (constexpr auto member:
+                  nonstatic_data_members_of(^^tile_type, std::meta::access_context::unchecked()) | to_static_array) {
+      tile.[:member:][index % Lanes] = value.[:nonstatic_data_member<value_type>(identifier_of(member)):];
+    }
+  }
+
+  constexpr void push_back(value_type const& item) {
+    if (size_ % Lanes == 0) {
+      data_.emplace_back();
+    }
+    set(size_++, item);
+  }
+
+  constexpr void pop_back() {
+    if (--size_ % Lanes == 0) {
+      data_.pop_back();
+    }
+  }
+
+  constexpr iterator erase(iterator const it) {
+    auto const index = static_cast<size_type>(it - begin());
+    return erase_range(index, index + 1);
+  }
+
+  constexpr iterator erase(const_iterator const it) {
+    auto const index = static_cast<size_type>(it - cbegin());
+    return erase_range(index, index + 1);
+  }
+
+  constexpr iterator erase(iterator const begin_it, iterator const end_it) {
+    return erase_range(static_cast<size_type>(begin_it - begin()), static_cast<size_type>(end_it - begin()));
+  }
+
+  template<std::ranges::forward_range R>
+    requires(std::convertible_to<std::ranges::range_reference_t<R>, value_type const&>)
+  constexpr void append_range(R&& range) {
+    reserve(size_ + static_cast<size_type>(std::ranges::distance(range)));
+    for (auto const& item: range) {
+      push_back(item);
+    }
+  }
+
+  /**
+   * Inserts [first, last) before `pos`, shifting the tail member by member
+   */
+  template<std::forward_iterator It>
+    requires(std::convertible_to<std::iter_reference_t<It>, value_type const&>)
+  constexpr iterator insert(iterator const pos, It first, It const last) {
+    auto const index    = static_cast<size_type>(pos - begin());
+    auto const count    = static_cast<size_type>(std::ranges::distance(first, last));
+    auto const old_size = size_;
+    resize(size_ + count);
+    template for (constexpr auto member:
+                  nonstatic_data_members_of(^^tile_type, std::meta::access_context::unchecked()) | to_static_array) {
+      for (size_type i = old_size; i-- > index;) {
+        data_[(i + count) / Lanes].[:member:][(i + count) % Lanes] = std::move(data_[i / Lanes].[:member:][i % Lanes]);
+      }
+    }
+    for (size_type i = index; first != last; ++first) {
+      set(i++, *first);
+    }
+    return {*this, index};
+  }
+
+  /**
+   * Resizes the container, lanes of the last tile that become visible are value initialized
+   */
+  constexpr void resize(size_type const new_size) {
+    auto const old_size = size_;
+    data_.resize(tiles_for(new_size));
+    size_ = new_size;
+    for (size_type i = old_size; i < std::min(new_size, tiles_for(old_size) * Lanes); ++i) {
+      set(i, value_type {});
+    }
+  }
+
+  // ********* Capacity *********
+
+  [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+
+  [[nodiscard]] constexpr size_type size() const noexcept { return size_; }
+
+  [[nodiscard]] constexpr size_type max_size() const noexcept { return data_.max_size(); }
+
+  [[nodiscard]] constexpr size_type capacity() const noexcept { return data_.capacity() * Lanes; }
+
+  constexpr void reserve(size_type const new_capacity) { data_.reserve(tiles_for(new_capacity)); }
+
+private:
+  static constexpr size_type tiles_for(size_type const size) { return (size + Lanes - 1) / Lanes; }
+
+  constexpr iterator erase_range(size_type const first, size_type const last) {
+    auto const count = last - first;
+    template for (constexpr auto member:
+                  nonstatic_data_members_of(^^tile_type, std::meta::access_context::unchecked()) | to_static_array) {
+      for (size_type i = first; i + count < size_; ++i) {
+        data_[i / Lanes].[:member:][i % Lanes] = std::move(data_[(i + count) / Lanes].[:member:][(i + count) % Lanes]);
+      }
+    }
+    size_ -= count;
+    data_.resize(tiles_for(size_));
+    return {*this, first};
+  }
+
+  underlying_container data_ {};
+  size_type size_ {};
+};
+
+} // namespace rflect
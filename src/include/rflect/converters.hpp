@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <rflect/converters/flatten.hpp>
 #include <rflect/converters/soa_to_zip.hpp>
 #include <rflect/converters/struct_to_soa.hpp>
 #include <rflect/converters/struct_to_tuple.hpp>
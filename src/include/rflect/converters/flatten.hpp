@@ -0,0 +1,269 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file flatten.hpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Nested member flattening
+ *
+ * Converters splitting class type members (e.g. a `vec3` position) into
+ * their own members, recursively, so structure of arrays containers can
+ * store one column per scalar (`position_x`, `position_y`, `position_z`)
+ */
+
+#pragma once
+
+#include <rflect/converters/struct_to_soa.hpp>
+#include <rflect/converters/to_static.hpp>
+#include <rflect/introspection/struct.hpp>
+
+#include <meta>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace rflect {
+
+template<typename T>
+class member_reference;
+
+namespace detail {
+
+/**
+ * Whether members of type `type` are split into their own members when flattening: standard layout class types,
+ * default constructible, whose nonstatic data members are all public, non array, non reference, non const and not bit
+ * fields. Vectors and similar math types qualify, `std::array`, `std::string` or `std::vector` do not
+ */
+consteval bool is_flattenable(std::meta::info type) {
+  type = dealias(type);
+  if (not is_class_type(type) or not is_standard_layout_type(type) or not is_default_constructible_type(type)) {
+    return false;
+  }
+  auto const members = nonstatic_data_members_of(type, std::meta::access_context::unchecked());
+  if (members.empty()) {
+    return false;
+  }
+  for (auto const member: members) {
+    auto const member_type = type_of(member);
+    if (not is_public(member) or is_bit_field(member) or is_array_type(member_type) or
+        is_reference_type(member_type) or is_const_type(member_type)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Number of members a member of type `type` becomes once flattened
+ */
+consteval std::size_t leaf_count(std::meta::info const type) {
+  if (not is_flattenable(type)) {
+    return 1;
+  }
+  std::size_t count = 0;
+  for (auto const member: nonstatic_data_members_of(type, std::meta::access_context::unchecked())) {
+    count += leaf_count(type_of(member));
+  }
+  return count;
+}
+
+/**
+ * Position of the first flattened member of `member` among the flattened members of its class. Flattened members
+ * keep declaration order, depth first, so every member maps to a contiguous run
+ */
+consteval std::size_t leaf_offset(std::meta::info const member) {
+  std::size_t offset = 0;
+  for (auto const sibling: nonstatic_data_members_of(parent_of(member), std::meta::access_context::unchecked())) {
+    if (sibling == member) {
+      return offset;
+    }
+    offset += leaf_count(type_of(sibling));
+  }
+  throw std::invalid_argument("No such nonstatic data member");
+}
+
+consteval void append_leaves(
+    std::meta::info const type, std::string const& prefix, std::vector<std::meta::info>& leaves
+) {
+  for (auto const member: nonstatic_data_members_of(type, std::meta::access_context::unchecked())) {
+    auto name = std::string(identifier_of(member));
+    if (not prefix.empty()) {
+      name = prefix + "_" + name;
+    }
+    if (is_flattenable(type_of(member))) {
+      append_leaves(type_of(member), name, leaves);
+    }
+    else {
+      leaves.push_back(data_member_spec(type_of(member), {.name = name}));
+    }
+  }
+}
+
+template<typename T>
+struct flat_struct {
+  struct impl;
+
+  consteval {
+    std::vector<std::meta::info> leaves = {};
+    append_leaves(^^T, "", leaves);
+    define_aggregate(^^impl, leaves);
+  }
+};
+
+template<typename T>
+struct struct_of_references {
+  struct impl;
+
+  consteval {
+    // clang-format off
+    std::vector<std::meta::info> old_members =
+        nonstatic_data_members_of(^^std::remove_const_t<T>, std::meta::access_context::unchecked());
+    std::vector<std::meta::info> new_members = {};
+
+    for (std::meta::info member: old_members) {
+      auto member_type    = std::is_const_v<T> ? add_const(type_of(member)) : type_of(member);
+      auto reference_type = is_flattenable(type_of(member))
+          ? substitute(^^member_reference, { member_type })
+          : add_lvalue_reference(member_type);
+      new_members.push_back(data_member_spec(reference_type, {.name = identifier_of(member)}));
+    }
+
+    define_aggregate(^^impl, new_members);
+    // clang-format on
+  }
+};
+
+template<typename Record, std::size_t First, typename Flat>
+constexpr void flatten_into(Record const& value, Flat& flat) {
+  template for (constexpr auto member:
+                nonstatic_data_members_of(^^Record, std::meta::access_context::unchecked()) | to_static_array) {
+    constexpr auto leaf = First + leaf_offset(member);
+    if constexpr (is_flattenable(type_of(member))) {
+      flatten_into<typename[:type_of(member):], leaf>(value.[:member:], flat);
+    }
+    else {
+      flat.[:nonstatic_data_member<Flat>(leaf):] = value.[:member:];
+    }
+  }
+}
+
+template<typename Record, std::size_t First, typename Flat>
+constexpr void unflatten_into(Flat const& flat, Record& value) {
+  template for (constexpr auto member:
+                nonstatic_data_members_of(^^Record, std::meta::access_context::unchecked()) | to_static_array) {
+    constexpr auto leaf = First + leaf_offset(member);
+    if constexpr (is_flattenable(type_of(member))) {
+      unflatten_into<typename[:type_of(member):], leaf>(flat, value.[:member:]);
+    }
+    else {
+      value.[:member:] = flat.[:nonstatic_data_member<Flat>(leaf):];
+    }
+  }
+}
+
+} // namespace detail
+
+/**
+ * @brief Type alias that generates a struct with the members of `T`, class type members replaced by their members.
+ *
+ * Members whose type is a plain class with public members (see `detail::is_flattenable`, e.g. a `vec3`) are split
+ * recursively, and the resulting members are named after their path joined by underscores: `position.x` becomes
+ * `position_x`. Every other member is kept as is. Members keep declaration order, depth first.
+ *
+ * @tparam T The struct type to be transformed.
+ */
+template<typename T>
+using flat_struct = typename detail::flat_struct<T>::impl;
+
+/**
+ * @brief Type alias that generates a structure of `std::vector`s with one vector per flattened member of `T`.
+ *
+ * Opt-in recursive mode of `struct_of_vectors`: `struct_of_vectors` keeps a `vec3` member as a vector of `vec3`,
+ * this alias stores one vector per coordinate.
+ *
+ * @tparam T The struct type to be transformed.
+ * @tparam Alloc Allocator template to be used for each vector (defaults to `std::allocator`).
+ * @tparam Align Column alignment, see `struct_of_vectors`.
+ */
+template<typename T, template<class> class Alloc = std::allocator, std::size_t Align = 0>
+using flat_struct_of_vectors = struct_of_vectors<flat_struct<T>, Alloc, Align>;
+
+/**
+ * @brief Copies `value` into its flattened representation
+ */
+template<typename T>
+constexpr flat_struct<T> flatten(T const& value) {
+  flat_struct<T> flat {};
+  detail::flatten_into<T, 0>(value, flat);
+  return flat;
+}
+
+/**
+ * @brief Rebuilds a `T` from its flattened representation. Flattened class type members are default constructed and
+ * then assigned member by member
+ */
+template<typename T>
+constexpr T unflatten(flat_struct<T> const& flat) {
+  T value {};
+  detail::unflatten_into<T, 0>(flat, value);
+  return value;
+}
+
+/**
+ * @brief Reference to a flattened member of an element, made of one reference per member of `T`.
+ *
+ * What the proxies of flattened containers return for class type members: the members of `T` stay reachable by name
+ * (`particle.position().x` refers to the `position_x` column), it converts to a `T` copy, and assigning a `T` (or
+ * another reference) writes every member back to its column. Nested class type members are `member_reference`s too.
+ *
+ * @tparam T Referenced type, const qualified for read only references
+ */
+template<typename T>
+class member_reference : public detail::struct_of_references<T>::impl {
+public:
+  using value_type      = std::remove_const_t<T>;
+  using references_type = typename detail::struct_of_references<T>::impl;
+
+  constexpr explicit member_reference(references_type const& references) : references_type(references) { }
+
+  constexpr member_reference(member_reference const& other) = default;
+
+  constexpr operator value_type() const { // NOLINT: implicit, a reference converts to the referenced value
+    value_type value {};
+    template for (constexpr auto index: std::views::iota(0UZ, members_count)) {
+      constexpr auto member = nonstatic_data_member<value_type>(index);
+      value.[:member:]      = static_cast<typename[:type_of(member):]>(this->[:reference<index>:]);
+    }
+    return value;
+  }
+
+  /**
+   * Writes every member of `value` through the references. Const, like assigning through a reference
+   */
+  constexpr member_reference const& operator=(value_type const& value) const
+    requires(not std::is_const_v<T>)
+  {
+    template for (constexpr auto index: std::views::iota(0UZ, members_count)) {
+      this->[:reference<index>:] = value.[:nonstatic_data_member<value_type>(index):];
+    }
+    return *this;
+  }
+
+  constexpr member_reference const& operator=(member_reference const& other) const
+    requires(not std::is_const_v<T>)
+  {
+    return *this = static_cast<value_type>(other);
+  }
+
+private:
+  template<std::size_t I>
+  static constexpr auto reference = nonstatic_data_member<references_type>(I);
+
+  static constexpr auto members_count =
+      (nonstatic_data_members_of(^^value_type, std::meta::access_context::unchecked())).size();
+};
+
+} // namespace rflect
@@ -14,7 +14,11 @@
 
 #pragma once
 
+#include <rflect/containers/aligned_allocator.hpp>
+#include <rflect/introspection/struct.hpp>
+
 #include <meta>
+#include <span>
 
 namespace rflect {
 
@@ -42,7 +46,7 @@ struct struct_of_arrays {
   }
 };
 
-template<class T, template<class> class Alloc>
+template<class T, template<class> class Alloc, std::size_t Align>
 struct struct_of_vectors {
   struct impl;
 
@@ -52,7 +56,9 @@ struct struct_of_vectors {
     std::vector<std::meta::info> new_members = {};
 
     for (std::meta::info member: old_members) {
-      auto allocator = substitute(^^Alloc, { type_of(member) });
+      auto allocator = Align == 0
+          ? substitute(^^Alloc, { type_of(member) })
+          : substitute(^^aligned_allocator, { type_of(member), ^^Alloc, std::meta::reflect_constant(Align) });
       auto array_type = substitute(^^std::vector, { type_of(member), allocator });
       auto mem_descr = data_member_spec(array_type, {.name = identifier_of(member)});
       new_members.push_back(mem_descr);
@@ -83,20 +89,96 @@ struct struct_of_pointers {
   }
 };
 
+template<class T>
+struct struct_of_spans {
+  struct impl;
+
+  consteval {
+    // clang-format off
+    std::vector<std::meta::info> old_members =
+        nonstatic_data_members_of(^^std::remove_const_t<T>, std::meta::access_context::unchecked());
+    std::vector<std::meta::info> new_members = {};
+
+    for (std::meta::info member: old_members) {
+      auto element_type = std::is_const_v<T> ? add_const(type_of(member)) : type_of(member);
+      auto span_type = substitute(^^std::span, { element_type });
+      auto mem_descr = data_member_spec(span_type, {.name = identifier_of(member)});
+      new_members.push_back(mem_descr);
+    }
+
+    define_aggregate(^^impl, new_members);
+    // clang-format on
+  }
+};
+
+template<class T, bool Selected, auto... Members>
+struct struct_of_members {
+  struct impl;
+
+  consteval {
+    // clang-format off
+    std::vector<std::meta::info> old_members = nonstatic_data_members_of(^^T, std::meta::access_context::unchecked());
+    std::vector<std::meta::info> new_members = {};
+
+    for (std::meta::info member: old_members) {
+      bool const selected = ((member == nonstatic_data_member<T>(Members)) or ...);
+      if (selected == Selected) {
+        new_members.push_back(data_member_spec(type_of(member), {.name = identifier_of(member)}));
+      }
+    }
+
+    define_aggregate(^^impl, new_members);
+    // clang-format on
+  }
+};
+
 } // namespace detail
 
 /**
- * @brief Type alias that generates a structure of pointers`s from a given struct type.
+ * @brief Type alias that generates a struct with only the selected members of a given struct type.
+ *
+ * Members keep their type, name and declaration order in `T`, whatever the order of `Members`.
+ *
+ * @tparam T The struct type to be transformed.
+ * @tparam Members Pointers to the data members to keep (e.g. `&T::member`).
+ */
+template<typename T, auto... Members>
+using struct_with = typename detail::struct_of_members<T, true, Members...>::impl;
+
+/**
+ * @brief Type alias that generates a struct with every member of a given struct type but the selected ones.
+ *
+ * Complement of `struct_with`.
+ *
+ * @tparam T The struct type to be transformed.
+ * @tparam Members Pointers to the data members to drop (e.g. `&T::member`).
+ */
+template<typename T, auto... Members>
+using struct_without = typename detail::struct_of_members<T, false, Members...>::impl;
+
+/**
+ * @brief Type alias that generates a structure of pointers from a given struct type.
  *
  * For a given struct type `T`, this alias produces a new struct where each member is
- * replaced with a `std::vector` of the corresponding type. This allows storing multiple
- * instances of `T` in a structure-of-arrays (SoA) layout, which is often more cache-friendly.
+ * replaced with a pointer to the corresponding type. Containers owning their column storage
+ * use it to keep the base address of every column.
+ *
+ * @tparam T The struct type to be transformed.
+ */
+template<typename T>
+using struct_of_pointers = typename detail::struct_of_pointers<T>::impl;
+
+/**
+ * @brief Type alias that generates a structure of `std::span`s from a given struct type.
+ *
+ * For a given struct type `T`, this alias produces a new struct where each member is
+ * replaced with a `std::span` of the corresponding type. If `T` is const qualified the spans
+ * refer to const elements. It is the non owning view of a structure-of-arrays.
  *
  * @tparam T The struct type to be transformed.
- * @tparam Alloc Allocator template to be used for each vector (defaults to `std::allocator`).
  */
-template<typename T, template<class> class Alloc = std::allocator>
-using struct_of_pointers = typename detail::struct_of_vectors<T, Alloc>::impl;
+template<typename T>
+using struct_of_spans = typename detail::struct_of_spans<T>::impl;
 
 /**
  * @brief Type alias that generates a structure of `std::vector`s from a given struct type.
@@ -107,9 +189,11 @@ using struct_of_pointers = typename detail::struct_of_vectors<T, Alloc>::impl;
  *
  * @tparam T The struct type to be transformed.
  * @tparam Alloc Allocator template to be used for each vector (defaults to `std::allocator`).
+ * @tparam Align When not 0, every vector allocates through `aligned_allocator<Member, Alloc, Align>`, so each column
+ * starts on an `Align` boundary and is padded to a multiple of `Align` bytes.
  */
-template<typename T, template<class> class Alloc = std::allocator>
-using struct_of_vectors = typename detail::struct_of_vectors<T, Alloc>::impl;
+template<typename T, template<class> class Alloc = std::allocator, std::size_t Align = 0>
+using struct_of_vectors = typename detail::struct_of_vectors<T, Alloc, Align>::impl;
 
 /**
  * @brief Type alias that generates a structure of `std::array`s from a given struct type.
@@ -10,5 +10,10 @@
  */
 #pragma once
 
+#include <rflect/introspection/convert_layout.hpp>
 #include <rflect/introspection/enum.hpp>
+#include <rflect/introspection/for_each.hpp>
+#include <rflect/introspection/permute.hpp>
+#include <rflect/introspection/sort.hpp>
 #include <rflect/introspection/struct.hpp>
+#include <rflect/introspection/transform_columns.hpp>
@@ -0,0 +1,158 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file convert_layout.hpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Array of structures <-> structure of arrays conversions
+ *
+ * Copies a dual_vector into another memory layout with a blocked
+ * transpose: a block of elements small enough to stay in L1 is walked
+ * once per member, so every column is written (or read) in long runs
+ */
+#pragma once
+
+#include <rflect/concepts/layout_concepts.hpp>
+#include <rflect/containers/dual_vector.hpp>
+#include <rflect/converters/to_static.hpp>
+#include <rflect/introspection/for_each.hpp>
+#include <rflect/introspection/struct.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <span>
+
+namespace rflect {
+
+namespace detail {
+
+inline constexpr std::size_t transpose_block_bytes = 16 * 1024; // Half of a typical L1 data cache
+
+/**
+ * Elements per transposed block, a multiple of the elements in a cache line
+ */
+template<typename T>
+consteval std::size_t transpose_block() {
+  constexpr auto line = elements_per_line<T>();
+  return std::max(line, transpose_block_bytes / sizeof(T) / line * line);
+}
+
+/**
+ * Structure of arrays layouts whose columns are the members of `T`, one column each
+ */
+template<typename Layout, typename T, template<typename> class Alloc>
+concept per_member_columns = soa_layout<Layout> and not std::same_as<Layout, layout::soa_flat> and
+                             columnar<typename Layout::template vector<T, Alloc>>;
+
+/**
+ * Layout pairs `convert_layout` transposes between
+ */
+template<typename From, typename To, typename T, template<typename> class Alloc>
+concept transposable_layouts = (aos_layout<From> and per_member_columns<To, T, Alloc>) or
+                               (per_member_columns<From, T, Alloc> and aos_layout<To>);
+
+template<typename T, typename Spans>
+constexpr void transpose_to_columns(T const* const elements, Spans const& columns, std::size_t first,
+                                    std::size_t const last) {
+  for (; first < last; first += transpose_block<T>()) {
+    auto const block_end = std::min(first + transpose_block<T>(), last);
+    template for (constexpr auto member:
+                  nonstatic_data_members_of(^^T, std::meta::access_context::unchecked()) | to_static_array) {
+      auto* const column = columns.[:nonstatic_data_member<Spans>(identifier_of(member)):].data();
+      for (auto i = first; i < block_end; ++i) {
+        column[i] = elements[i].[:member:];
+      }
+    }
+  }
+}
+
+template<typename T, typename Spans>
+constexpr void transpose_to_elements(Spans const& columns, T* const elements, std::size_t first,
+                                     std::size_t const last) {
+  for (; first < last; first += transpose_block<T>()) {
+    auto const block_end = std::min(first + transpose_block<T>(), last);
+    template for (constexpr auto member:
+                  nonstatic_data_members_of(^^T, std::meta::access_context::unchecked()) | to_static_array) {
+      auto const* const column = columns.[:nonstatic_data_member<Spans>(identifier_of(member)):].data();
+      for (auto i = first; i < block_end; ++i) {
+        elements[i].[:member:] = column[i];
+      }
+    }
+  }
+}
+
+} // namespace detail
+
+/**
+ * @brief Copies `source` into a `dual_vector` with memory layout `To`, between array of structures and structure of
+ * arrays layouts.
+ *
+ * ```cpp
+ * auto particles = rflect::convert_layout<rflect::layout::soa>(rflect::execution::par, parsed_particles);
+ * ```
+ *
+ * Instead of pushing elements one by one through proxies, which touches every column once per element, the
+ * elements are transposed in blocks of `detail::transpose_block` elements: each member is copied for the whole block
+ * before moving to the next one, while the array of structures side of the block stays cached. Member loops are
+ * plain strided copies the compiler can vectorize. The result uses the allocator of `source`.
+ *
+ * Sequentially, the result reserves `source.size()` elements and grows one block at a time: columns are appended
+ * member by member from the block of elements, and elements are value initialized one block at a time and then
+ * overwritten member by member, so the extra initialization pass only touches a block that is still cached. With
+ * `execution::par` the result is sized up front and workers overwrite chunks starting at cache line boundaries of the
+ * destination (see `for_each_chunk`), which costs one extra pass of value initialization over the whole result.
+ *
+ * @tparam To Destination layout, `layout::aos` if `source` is SoA, or a SoA layout storing one column per member
+ * (every one but `layout::soa_flat`) if `source` is AoS
+ * @param policy `execution::seq` or `execution::par`
+ * @param source Container to be copied
+ */
+template<memory_layout To, typename Policy, typename T, memory_layout From, template<typename> class Alloc>
+  requires(detail::transposable_layouts<From, To, T, Alloc>)
+constexpr dual_vector<T, To, Alloc> convert_layout(Policy const policy, dual_vector<T, From, Alloc> const& source) {
+  dual_vector<T, To, Alloc> result(source.get_allocator());
+  if constexpr (std::same_as<Policy, execution::sequenced_policy>) {
+    result.reserve(source.size());
+    for (std::size_t first = 0; first < source.size(); first += detail::transpose_block<T>()) {
+      auto const last = std::min(first + detail::transpose_block<T>(), source.size());
+      if constexpr (aos_layout<From>) {
+        result.append_range(std::span(source.data() + first, last - first));
+      }
+      else {
+        result.resize(last);
+        detail::transpose_to_elements(source.spans(), result.data(), first, last);
+      }
+    }
+    return result;
+  }
+
+  result.resize(source.size());
+  if constexpr (aos_layout<From>) {
+    auto const columns = result.spans();
+    for_each_chunk(policy, result, [&source, &columns](auto const chunk) {
+      detail::transpose_to_columns(source.data(), columns, chunk.begin().index(), chunk.end().index());
+    });
+  }
+  else {
+    auto const columns   = source.spans();
+    auto* const elements = result.data();
+    for_each_chunk(policy, result, [&columns, elements](auto const chunk) {
+      detail::transpose_to_elements(columns, elements, chunk.begin().index(), chunk.end().index());
+    });
+  }
+  return result;
+}
+
+/**
+ * @brief Copies `source` into a `dual_vector` with memory layout `To` on the calling thread, see the overload taking
+ * an execution policy
+ */
+template<memory_layout To, typename T, memory_layout From, template<typename> class Alloc>
+  requires(detail::transposable_layouts<From, To, T, Alloc>)
+constexpr dual_vector<T, To, Alloc> convert_layout(dual_vector<T, From, Alloc> const& source) {
+  return convert_layout<To>(execution::seq, source);
+}
+
+} // namespace rflect
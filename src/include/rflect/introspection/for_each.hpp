@@ -6,10 +6,139 @@
  * @file for_each.hpp
  * @version 1.0
  * @date 4/30/25
- * @brief Short description
+ * @brief Parallel for_each over rflect containers
  *
- * Longer description
+ * Splits a container in chunks whose boundaries fall on cache line
+ * boundaries of every member column and processes them on the threads of
+ * a pool shared by every parallel algorithm (see `worker_pool`)
  */
 #pragma once
 
+#include <rflect/concepts/layout_concepts.hpp>
 #include <rflect/converters/to_static.hpp>
+#include <rflect/introspection/worker_pool.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <ranges>
+#include <thread>
+
+namespace rflect {
+
+namespace execution {
+
+/**
+ * @brief Runs every chunk on the calling thread
+ */
+struct sequenced_policy {};
+
+/**
+ * @brief Splits the work among `threads` workers, run by the shared worker pool. The calling thread processes the first
+ * chunk
+ */
+struct parallel_policy {
+  std::size_t threads = 0; // 0 selects std::thread::hardware_concurrency()
+};
+
+inline constexpr sequenced_policy seq {};
+inline constexpr parallel_policy par {};
+
+} // namespace execution
+
+namespace detail {
+
+inline constexpr std::size_t cache_line_size = 64;
+
+inline std::size_t worker_count(execution::parallel_policy const policy) {
+  return policy.threads != 0 ? policy.threads : std::max(1U, std::thread::hardware_concurrency());
+}
+
+template<typename T>
+consteval std::size_t elements_per_line() {
+  return cache_line_size / std::gcd(cache_line_size, sizeof(T));
+}
+
+/**
+ * Smallest number of elements such that a chunk starting at a multiple of it starts at a cache line boundary of
+ * every column (or of the element array for AoS containers)
+ */
+template<typename Container>
+consteval std::size_t chunk_granularity() {
+  using value_type = typename Container::value_type;
+  if constexpr (columnar<Container>) {
+    std::size_t granularity = 1;
+    template for (constexpr auto member:
+                  nonstatic_data_members_of(^^value_type, std::meta::access_context::unchecked()) | to_static_array) {
+      granularity = std::lcm(granularity, elements_per_line<typename[:type_of(member):]>());
+    }
+    return granularity;
+  }
+  else {
+    return elements_per_line<value_type>();
+  }
+}
+
+template<typename Container, typename Fn>
+constexpr void run_chunk(Container& container, std::size_t const first, std::size_t const last, Fn& fn) {
+  using difference_type = std::ranges::range_difference_t<Container>;
+  auto const begin      = std::ranges::begin(container);
+  auto const chunk_end  = begin + static_cast<difference_type>(last);
+  std::invoke(fn, std::ranges::subrange(begin + static_cast<difference_type>(first), chunk_end));
+}
+
+} // namespace detail
+
+template<typename Container>
+concept chunkable = std::ranges::random_access_range<Container> and std::ranges::sized_range<Container>;
+
+/**
+ * @brief Invokes `fn` with the whole container as a single `std::ranges::subrange`
+ */
+template<chunkable Container, typename Fn>
+constexpr void for_each_chunk(execution::sequenced_policy, Container& container, Fn fn) {
+  detail::run_chunk(container, 0, std::ranges::size(container), fn);
+}
+
+/**
+ * @brief Splits the container in one chunk per worker and invokes `fn` with each chunk as a `std::ranges::subrange`.
+ *
+ * Chunk sizes are rounded up to `detail::chunk_granularity`, so two workers never write the same cache line of a
+ * column (as long as the column itself starts at a cache line, e.g. `packed_multi_vector`). Workers can map their
+ * chunk onto the member spans of SoA containers through the iterators `index()`. Chunks run on `detail::shared_pool`,
+ * whose threads are started once, so no thread is started per call.
+ *
+ * @note `fn` must not throw, an exception escaping a worker terminates the program.
+ */
+template<chunkable Container, typename Fn>
+void for_each_chunk(execution::parallel_policy const policy, Container& container, Fn fn) {
+  constexpr auto granularity = detail::chunk_granularity<Container>();
+
+  auto const size    = static_cast<std::size_t>(std::ranges::size(container));
+  auto const workers = detail::worker_count(policy);
+  auto const chunk   = ((size + workers - 1) / workers + granularity - 1) / granularity * granularity;
+  if (chunk == 0 or chunk >= size) {
+    detail::run_chunk(container, 0, size, fn);
+    return;
+  }
+
+  detail::shared_pool().run((size + chunk - 1) / chunk, [&container, &fn, chunk, size](std::size_t const worker) {
+    detail::run_chunk(container, worker * chunk, std::min((worker + 1) * chunk, size), fn);
+  });
+}
+
+/**
+ * @brief Invokes `fn` on every element of the container (proxies for `dual_vector`, reference tuples for
+ * `multi_vector`), splitting the work as `for_each_chunk` does
+ */
+template<typename Policy, chunkable Container, typename Fn>
+  requires(std::invocable<Fn&, std::ranges::range_reference_t<Container>&>)
+void for_each(Policy const policy, Container& container, Fn fn) {
+  for_each_chunk(policy, container, [&fn](auto chunk) {
+    for (auto&& element: chunk) {
+      std::invoke(fn, element);
+    }
+  });
+}
+
+} // namespace rflect
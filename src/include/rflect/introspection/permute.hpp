@@ -0,0 +1,300 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file permute.hpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Index permutations applied to every member column
+ *
+ * Reorders the elements of a container one member column at a time, so a
+ * permutation computed once (by sorting a key array, a counting sort over
+ * cell indices...) moves every member without going through proxies
+ */
+#pragma once
+
+#include <rflect/concepts/layout_concepts.hpp>
+#include <rflect/converters/to_static.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace rflect {
+
+/**
+ * Random access ranges of integral indices, as taken by `permute`, `gather` and `scatter`
+ */
+template<typename Indices>
+concept index_range = std::ranges::random_access_range<Indices> and std::ranges::sized_range<Indices> and
+                      std::integral<std::ranges::range_value_t<Indices>>;
+
+namespace permutation {
+
+/**
+ * @brief Gathers every column into a scratch buffer and moves it back. Two sequential passes per column, needs as much
+ * extra memory as the largest column
+ */
+struct buffered_policy {};
+
+/**
+ * @brief Follows the cycles of the permutation inside every column. Only needs one bit per element of extra memory,
+ * but every move is a random access
+ */
+struct in_place_policy {};
+
+inline constexpr buffered_policy buffered {};
+inline constexpr in_place_policy in_place {};
+
+} // namespace permutation
+
+namespace detail {
+
+inline constexpr std::size_t prefetch_distance  = 16;      // Elements ahead of the current one
+inline constexpr std::size_t prefetch_threshold = 1 << 20; // Column bytes, smaller columns are likely cached
+
+/**
+ * Hints the cache about an upcoming random access (`Write` for stores)
+ */
+template<bool Write = false>
+constexpr void prefetch([[maybe_unused]] void const* const address) {
+  if !consteval {
+#if defined(__GNUC__) or defined(__clang__)
+    __builtin_prefetch(address, Write ? 1 : 0);
+#endif
+  }
+}
+
+template<typename Container>
+concept resizable = requires(Container& container, std::size_t const size) { container.resize(size); };
+
+/**
+ * Invokes `fn(i, column[indices[i]])` for every `i` in order. Random reads into columns larger than the cache are
+ * prefetched `prefetch_distance` indices ahead
+ */
+template<typename T, index_range Indices, typename Fn>
+constexpr void visit_gathered(std::span<T> const column, Indices const& indices, Fn&& fn) {
+  auto const size     = static_cast<std::size_t>(std::ranges::size(indices));
+  auto const prefetch = column.size_bytes() > prefetch_threshold;
+  for (std::size_t i = 0; i < size; ++i) {
+    if (prefetch and i + prefetch_distance < size) {
+      detail::prefetch(column.data() + indices[i + prefetch_distance]);
+    }
+    fn(i, column[static_cast<std::size_t>(indices[i])]);
+  }
+}
+
+template<typename T, index_range Indices>
+constexpr void permute_column(permutation::buffered_policy, std::span<T> const column, Indices const& indices) {
+  std::vector<T> scratch;
+  scratch.reserve(column.size());
+  visit_gathered(column, indices, [&scratch](std::size_t, T& value) { scratch.push_back(std::move(value)); });
+  std::ranges::move(scratch, column.begin());
+}
+
+/**
+ * Cycle following: the element landing on `i` is taken from `indices[i]`, whose slot is then filled from
+ * `indices[indices[i]]`... until the cycle comes back to `i`
+ */
+template<typename T, index_range Indices>
+constexpr void permute_column(permutation::in_place_policy, std::span<T> const column, Indices const& indices) {
+  std::vector<bool> placed(column.size());
+  for (std::size_t start = 0; start < column.size(); ++start) {
+    if (placed[start]) {
+      continue;
+    }
+    T value            = std::move(column[start]);
+    std::size_t target = start;
+    for (auto source = static_cast<std::size_t>(indices[target]); source != start;
+         source      = static_cast<std::size_t>(indices[target])) {
+      column[target] = std::move(column[source]);
+      placed[target] = true;
+      target         = source;
+    }
+    column[target] = std::move(value);
+    placed[target] = true;
+  }
+}
+
+template<typename T, typename U, index_range Indices>
+constexpr void gather_column(std::span<T> const column, Indices const& indices, std::span<U> const out) {
+  visit_gathered(column, indices, [&out](std::size_t const i, T const& value) { out[i] = value; });
+}
+
+template<typename T, typename U, index_range Indices>
+constexpr void scatter_column(std::span<T> const column, Indices const& indices, std::span<U> const out) {
+  auto const size     = static_cast<std::size_t>(std::ranges::size(indices));
+  auto const prefetch = out.size_bytes() > prefetch_threshold;
+  for (std::size_t i = 0; i < size; ++i) {
+    if (prefetch and i + prefetch_distance < size) {
+      detail::prefetch<true>(out.data() + indices[i + prefetch_distance]);
+    }
+    out[static_cast<std::size_t>(indices[i])] = column[i];
+  }
+}
+
+/**
+ * Copy of the element at `index`. Elements of columnar containers are reference tuples, which are rebuilt into a
+ * `value_type`, proxies convert to it
+ */
+template<typename Container>
+constexpr auto load_element(Container const& container, std::size_t const index) -> typename Container::value_type {
+  using value_type   = typename Container::value_type;
+  auto const element = container[index];
+  if constexpr (std::convertible_to<decltype(element), value_type>) {
+    return element;
+  }
+  else {
+    return std::apply([](auto const&... members) { return value_type {members...}; }, element);
+  }
+}
+
+/**
+ * Writes `value` into the element at `index`, member by member when the element is a reference tuple
+ */
+template<typename Out>
+constexpr void store_element(Out& out, std::size_t const index, typename Out::value_type const& value) {
+  using value_type = typename Out::value_type;
+  if constexpr (requires { out[index] = value; }) {
+    out[index] = value;
+  }
+  else {
+    auto const element = out[index];
+    template for (constexpr auto member: std::views::iota(0UZ, std::tuple_size_v<decltype(element)>)) {
+      std::get<member>(element) = value.[:nonstatic_data_member<value_type>(member):];
+    }
+  }
+}
+
+/**
+ * Calls `fn(column, out_column)` for every pair of member columns of two columnar containers, matched by position
+ */
+template<typename Container, typename Out, typename Fn>
+constexpr void zip_columns(Container& container, Out& out, Fn&& fn) {
+  using spans_type = decltype(container.spans());
+  using out_type   = decltype(out.spans());
+  constexpr auto columns =
+      nonstatic_data_members_of(^^spans_type, std::meta::access_context::unchecked()).size();
+
+  auto const spans = container.spans();
+  auto const outs  = out.spans();
+  template for (constexpr auto index: std::views::iota(0UZ, columns)) {
+    fn(spans.[:nonstatic_data_member<spans_type>(index):], outs.[:nonstatic_data_member<out_type>(index):]);
+  }
+}
+
+} // namespace detail
+
+/**
+ * @brief Reorders the elements of `container` so that element `i` becomes the former element `indices[i]`.
+ *
+ * Columnar containers (`multi_vector`, `multi_array`, `packed_multi_vector`, SoA `dual_vector`/`dual_array`) are
+ * permuted one member column at a time, applying the same indices to every column. Contiguous containers of whole
+ * elements are permuted directly, any other container (AoS and gather `dual_vector`...) through its proxies, which
+ * always goes through a buffer of whole elements.
+ *
+ * @param policy `permutation::buffered` (default) or `permutation::in_place`
+ * @param indices A permutation of `[0, size)`, e.g. the result of an argsort
+ */
+template<typename Policy, typename Container, index_range Indices>
+  requires(std::same_as<Policy, permutation::buffered_policy> or std::same_as<Policy, permutation::in_place_policy>)
+constexpr void permute(Policy const policy, Container& container, Indices const& indices) {
+  assert(std::ranges::size(indices) == std::ranges::size(container));
+
+  if constexpr (detail::columnar<Container>) {
+    using spans_type = decltype(container.spans());
+    auto const spans = container.spans();
+    template for (constexpr auto column:
+                  nonstatic_data_members_of(^^spans_type, std::meta::access_context::unchecked()) | to_static_array) {
+      detail::permute_column(policy, spans.[:column:], indices);
+    }
+  }
+  else if constexpr (std::ranges::contiguous_range<Container>) {
+    detail::permute_column(policy, std::span(container), indices);
+  }
+  else {
+    std::vector<typename Container::value_type> scratch;
+    scratch.reserve(std::ranges::size(indices));
+    for (auto const index: indices) {
+      scratch.push_back(detail::load_element(std::as_const(container), static_cast<std::size_t>(index)));
+    }
+    for (std::size_t i = 0; i < scratch.size(); ++i) {
+      container[i] = scratch[i];
+    }
+  }
+}
+
+template<typename Container, index_range Indices>
+constexpr void permute(Container& container, Indices const& indices) {
+  permute(permutation::buffered, container, indices);
+}
+
+/**
+ * @brief Out of place permutation: `out[i] = container[indices[i]]` for every `i` in `[0, indices.size())`.
+ *
+ * Columnar containers are gathered column by column into the matching columns of `out`, which may be a different
+ * columnar container of the same value type (e.g. `multi_vector` into `packed_multi_vector`). Any other pairing (e.g.
+ * `multi_vector` into `std::vector`) copies whole elements, rebuilt from the columns on the columnar side. `indices`
+ * need not be a permutation, repeated or missing indices select a subset. Resizable outputs are resized to
+ * `indices.size()`, fixed size ones must already be large enough.
+ */
+template<typename Container, index_range Indices, typename Out>
+  requires(std::same_as<typename Container::value_type, typename Out::value_type>)
+constexpr void gather(Container const& container, Indices const& indices, Out& out) {
+  auto const size = static_cast<std::size_t>(std::ranges::size(indices));
+  if constexpr (detail::resizable<Out>) {
+    out.resize(size);
+  }
+  assert(std::ranges::size(out) >= size);
+
+  if constexpr (detail::columnar<Container const> and detail::columnar<Out>) {
+    detail::zip_columns(container, out, [&indices](auto const column, auto const out_column) {
+      detail::gather_column(column, indices, out_column);
+    });
+  }
+  else if constexpr (std::ranges::contiguous_range<Container const> and std::ranges::contiguous_range<Out>) {
+    detail::gather_column(std::span(container), indices, std::span(out));
+  }
+  else {
+    for (std::size_t i = 0; i < size; ++i) {
+      detail::store_element(out, i, detail::load_element(container, static_cast<std::size_t>(indices[i])));
+    }
+  }
+}
+
+/**
+ * @brief Inverse of `gather`: `out[indices[i]] = container[i]` for every `i` in `[0, container.size())`.
+ *
+ * Useful when the destination of every element is known (a counting sort, a partition...) rather than its source.
+ * Resizable outputs are resized to `container.size()`, fixed size ones must be large enough to hold every index.
+ */
+template<typename Container, index_range Indices, typename Out>
+  requires(std::same_as<typename Container::value_type, typename Out::value_type>)
+constexpr void scatter(Container const& container, Indices const& indices, Out& out) {
+  assert(std::ranges::size(indices) == std::ranges::size(container));
+  if constexpr (detail::resizable<Out>) {
+    out.resize(std::ranges::size(container));
+  }
+
+  if constexpr (detail::columnar<Container const> and detail::columnar<Out>) {
+    detail::zip_columns(container, out, [&indices](auto const column, auto const out_column) {
+      detail::scatter_column(column, indices, out_column);
+    });
+  }
+  else if constexpr (std::ranges::contiguous_range<Container const> and std::ranges::contiguous_range<Out>) {
+    detail::scatter_column(std::span(container), indices, std::span(out));
+  }
+  else {
+    for (std::size_t i = 0; i < std::ranges::size(container); ++i) {
+      detail::store_element(out, static_cast<std::size_t>(indices[i]), detail::load_element(container, i));
+    }
+  }
+}
+
+} // namespace rflect
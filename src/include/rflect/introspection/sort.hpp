@@ -0,0 +1,299 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file sort.hpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Sorting containers by a single key column
+ *
+ * Sorts the indices of a key column (radix sort for arithmetic keys in
+ * natural or reverse order, a stable comparison sort otherwise) and then
+ * applies the resulting permutation to every column with `permute`, so
+ * no element is swapped as a whole while sorting
+ */
+#pragma once
+
+#include <rflect/introspection/for_each.hpp>
+#include <rflect/introspection/permute.hpp>
+#include <rflect/introspection/struct.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace rflect {
+
+namespace detail {
+
+inline constexpr std::size_t radix_bits_per_pass = 8;
+inline constexpr std::size_t radix_buckets       = std::size_t {1} << radix_bits_per_pass;
+inline constexpr std::size_t parallel_sort_grain = std::size_t {1} << 16; // Smaller inputs are sorted sequentially
+
+template<typename Comp>
+concept natural_order = std::same_as<Comp, std::ranges::less> or std::same_as<Comp, std::less<>>;
+
+template<typename Comp>
+concept reverse_order = std::same_as<Comp, std::ranges::greater> or std::same_as<Comp, std::greater<>>;
+
+/**
+ * Keys a radix sort can handle: integers and IEEE 754 floating point numbers of up to 64 bits
+ */
+template<typename Key>
+concept radix_key = (std::integral<Key> or (std::floating_point<Key> and std::numeric_limits<Key>::is_iec559)) and
+                    sizeof(Key) <= sizeof(std::uint64_t);
+
+template<std::size_t Size>
+using unsigned_of_size = std::conditional_t<
+    Size == 1, std::uint8_t,
+    std::conditional_t<Size == 2, std::uint16_t, std::conditional_t<Size == 4, std::uint32_t, std::uint64_t>>>;
+
+/**
+ * Unsigned integer whose natural order is the order of `key`. Negative floating point numbers are reversed, -0 is
+ * folded into +0 (they compare equal) and NaNs end up at both ends depending on their sign
+ */
+template<radix_key Key>
+constexpr auto radix_bits(Key const key) {
+  using bits_type          = unsigned_of_size<sizeof(Key)>;
+  constexpr bits_type sign = bits_type {1} << (std::numeric_limits<bits_type>::digits - 1);
+  if constexpr (std::floating_point<Key>) {
+    auto const bits = std::bit_cast<bits_type>(key == Key {0} ? Key {0} : key);
+    return (bits & sign) != 0 ? static_cast<bits_type>(~bits) : static_cast<bits_type>(bits | sign);
+  }
+  else if constexpr (std::signed_integral<Key>) {
+    return static_cast<bits_type>(static_cast<bits_type>(key) ^ sign);
+  }
+  else {
+    return static_cast<bits_type>(key);
+  }
+}
+
+/**
+ * Runs `fn(worker)` for every worker on the shared pool, every pass of a sort reuses the same threads
+ */
+template<typename Fn>
+void run_workers(std::size_t const workers, Fn const& fn) {
+  shared_pool().run(workers, fn);
+}
+
+/**
+ * Stable LSD radix sort of `order` by `bits`, one byte per pass. Passes where every key has the same digit are
+ * skipped. `workers` threads build per chunk histograms and scatter their chunk, which keeps the sort stable
+ */
+template<typename Bits>
+void radix_sort(std::vector<Bits>& bits, std::vector<std::size_t>& order, std::size_t const workers) {
+  auto const size  = bits.size();
+  auto const chunk = (size + workers - 1) / workers;
+  std::vector<Bits> bits_scratch(size);
+  std::vector<std::size_t> order_scratch(size);
+  std::vector<std::array<std::size_t, radix_buckets>> offsets(workers);
+
+  constexpr auto digits = static_cast<std::size_t>(std::numeric_limits<Bits>::digits);
+  for (std::size_t shift = 0; shift < digits; shift += radix_bits_per_pass) {
+    auto const digit = [shift](Bits const value) { return (value >> shift) & (radix_buckets - 1); };
+
+    run_workers(workers, [&](std::size_t const worker) {
+      offsets[worker].fill(0);
+      for (std::size_t i = worker * chunk; i < std::min(size, (worker + 1) * chunk); ++i) {
+        ++offsets[worker][digit(bits[i])];
+      }
+    });
+
+    // Bucket by bucket, every worker writes after the workers before it
+    std::size_t offset = 0;
+    bool skip          = false;
+    for (std::size_t bucket = 0; bucket < radix_buckets; ++bucket) {
+      std::size_t total = 0;
+      for (auto& histogram: offsets) {
+        total             += histogram[bucket];
+        histogram[bucket]  = offset + total - histogram[bucket];
+      }
+      skip   = skip or total == size;
+      offset += total;
+    }
+    if (skip) {
+      continue;
+    }
+
+    run_workers(workers, [&](std::size_t const worker) {
+      auto& histogram = offsets[worker];
+      for (std::size_t i = worker * chunk; i < std::min(size, (worker + 1) * chunk); ++i) {
+        auto const target     = histogram[digit(bits[i])]++;
+        bits_scratch[target]  = bits[i];
+        order_scratch[target] = order[i];
+      }
+    });
+    bits.swap(bits_scratch);
+    order.swap(order_scratch);
+  }
+}
+
+/**
+ * Stable comparison sort of `order` by `keys`: `workers` sorted chunks merged pairwise
+ */
+template<typename Key, typename Comp>
+void merge_sort(
+    std::span<Key const> const keys, std::vector<std::size_t>& order, Comp& comp, std::size_t const workers
+) {
+  auto const projection = [keys](std::size_t const index) -> Key const& { return keys[index]; };
+  auto const size       = order.size();
+  auto const chunk      = (size + workers - 1) / workers;
+  auto const begin      = order.begin();
+  auto const at         = [&](std::size_t const position) {
+    return begin + static_cast<std::ptrdiff_t>(std::min(position, size));
+  };
+
+  run_workers(workers, [&](std::size_t const worker) {
+    std::ranges::stable_sort(at(worker * chunk), at((worker + 1) * chunk), comp, projection);
+  });
+  for (std::size_t width = chunk; width < size; width *= 2) {
+    run_workers((size + 2 * width - 1) / (2 * width), [&](std::size_t const pair) {
+      auto const first = pair * 2 * width;
+      std::ranges::inplace_merge(at(first), at(first + width), at(first + 2 * width), comp, projection);
+    });
+  }
+}
+
+/**
+ * Invokes `fn` with a span over the `Member` key of every element: the column itself for columnar containers, a copy
+ * of the keys otherwise
+ */
+template<auto Member, typename Container, typename Fn>
+decltype(auto) with_keys(Container const& container, Fn&& fn) {
+  if constexpr (columnar<Container const>) {
+    auto&& items = container.template items<member_name<Member>>();
+    return fn(std::span(std::ranges::data(items), std::ranges::size(items)));
+  }
+  else {
+    using value_type = typename Container::value_type;
+    using key_type   = std::remove_cvref_t<decltype(std::declval<value_type const&>().*Member)>;
+
+    std::vector<key_type> keys;
+    keys.reserve(std::ranges::size(container));
+    if constexpr (std::ranges::contiguous_range<Container const>) {
+      for (auto const& element: container) {
+        keys.push_back(element.*Member);
+      }
+    }
+    else {
+      for (std::size_t i = 0; i < std::ranges::size(container); ++i) {
+        keys.push_back((*container[i]).*Member);
+      }
+    }
+    return fn(std::span<key_type const>(keys));
+  }
+}
+
+template<typename Key, typename Comp>
+std::vector<std::size_t> argsort(std::span<Key const> const keys, Comp& comp, std::size_t workers) {
+  std::vector<std::size_t> order(keys.size());
+  std::iota(order.begin(), order.end(), 0UZ);
+  workers = keys.size() < parallel_sort_grain ? 1 : std::min(workers, keys.size() / parallel_sort_grain);
+
+  if constexpr (radix_key<std::remove_const_t<Key>> and (natural_order<Comp> or reverse_order<Comp>)) {
+    using bits_type = decltype(radix_bits(keys[0]));
+    std::vector<bits_type> bits(keys.size());
+    run_workers(workers, [&](std::size_t const worker) {
+      auto const chunk = (keys.size() + workers - 1) / workers;
+      for (std::size_t i = worker * chunk; i < std::min(keys.size(), (worker + 1) * chunk); ++i) {
+        bits[i] = reverse_order<Comp> ? static_cast<bits_type>(~radix_bits(keys[i])) : radix_bits(keys[i]);
+      }
+    });
+    radix_sort(bits, order, workers);
+  }
+  else {
+    merge_sort(keys, order, comp, workers);
+  }
+  return order;
+}
+
+/**
+ * Applies `order` to every column of a columnar container, one worker per column
+ */
+template<typename Container>
+void permute_columns(execution::parallel_policy, Container& container, std::vector<std::size_t> const& order) {
+  if constexpr (columnar<Container>) {
+    using spans_type     = decltype(container.spans());
+    constexpr auto count = nonstatic_data_members_of(^^spans_type, std::meta::access_context::unchecked()).size();
+    auto const spans     = container.spans();
+    run_workers(count, [&spans, &order](std::size_t const worker) {
+      template for (constexpr auto column: std::views::iota(0UZ, count)) {
+        if (column == worker) {
+          permute_column(permutation::buffered, spans.[:nonstatic_data_member<spans_type>(column):], order);
+        }
+      }
+    });
+  }
+  else {
+    permute(container, order);
+  }
+}
+
+} // namespace detail
+
+/**
+ * @brief Indices that stably sort `container` by its `Member` column, without moving any element.
+ *
+ * Arithmetic keys compared with `std::ranges::less`/`std::ranges::greater` (or `std::less<>`/`std::greater<>`) are
+ * radix sorted, any other key or comparator falls back to a stable comparison sort.
+ */
+template<auto Member, chunkable Container, typename Comp = std::ranges::less>
+std::vector<std::size_t> argsort_by(Container const& container, Comp comp = {}) {
+  return detail::with_keys<Member>(container, [&comp](auto const keys) { return detail::argsort(keys, comp, 1); });
+}
+
+template<auto Member, chunkable Container, typename Comp = std::ranges::less>
+std::vector<std::size_t> argsort_by(
+    execution::parallel_policy const policy, Container const& container, Comp comp = {}
+) {
+  return detail::with_keys<Member>(container, [&](auto const keys) {
+    return detail::argsort(keys, comp, detail::worker_count(policy));
+  });
+}
+
+/**
+ * @brief Stably sorts `container` by its `Member` column.
+ *
+ * Only the key column is sorted (see `argsort_by`), the resulting permutation is then applied column by column with
+ * `permute`. Compared to sorting a `soa_to_zip` view, which swaps a tuple of references per step, every column is
+ * moved exactly once.
+ *
+ * ```cpp
+ * rflect::sort_by<&Particle::cell>(particles);
+ * rflect::sort_by<&Event::timestamp>(rflect::execution::par, events, std::ranges::greater {});
+ * ```
+ *
+ * @tparam Member Pointer to the data member used as key
+ * @param comp Strict weak ordering on the keys
+ */
+template<auto Member, chunkable Container, typename Comp = std::ranges::less>
+void sort_by(Container& container, Comp comp = {}) {
+  permute(container, argsort_by<Member>(container, comp));
+}
+
+template<auto Member, chunkable Container, typename Comp = std::ranges::less>
+void sort_by(execution::sequenced_policy, Container& container, Comp comp = {}) {
+  sort_by<Member>(container, comp);
+}
+
+/**
+ * @brief Parallel `sort_by`: the radix sort passes (or the comparison sort chunks) are split among `policy.threads`
+ * workers and every column is permuted by its own worker, all of them run by the shared worker pool (see
+ * `for_each_chunk`).
+ */
+template<auto Member, chunkable Container, typename Comp = std::ranges::less>
+void sort_by(execution::parallel_policy const policy, Container& container, Comp comp = {}) {
+  detail::permute_columns(policy, container, argsort_by<Member>(policy, container, comp));
+}
+
+} // namespace rflect
@@ -65,6 +65,45 @@ consteval auto nonstatic_data_member(std::string_view const identifier) {
   throw std::invalid_argument("No such nonstatic data member");
 }
 
+/**
+ * @brief Retrieves the non-static data member designated by a pointer to member of the given type.
+ *
+ * @tparam T The type to introspect.
+ * @param pointer Pointer to the data member to retrieve (e.g. `&T::member`).
+ * @return A metadata object representing the non-static data member pointed by `pointer`.
+ */
+template<typename T, typename M>
+consteval auto nonstatic_data_member(M T::* const pointer) {
+  template for (constexpr auto field:
+                nonstatic_data_members_of(^^T, std::meta::access_context::unchecked()) | to_static_array) {
+    if constexpr (std::same_as<decltype(&[:field:]), M T::*>) {
+      if (&[:field:] == pointer)
+        return field;
+    }
+  }
+  throw std::invalid_argument("No such nonstatic data member");
+}
+
+namespace detail {
+
+template<typename>
+struct member_pointer_class;
+
+template<typename M, typename C>
+struct member_pointer_class<M C::*> {
+  using type = C;
+};
+
+/**
+ * Static string with the identifier of the member designated by a pointer to member
+ */
+template<auto Member>
+inline constexpr char const* member_name = std::define_static_string(
+    identifier_of(nonstatic_data_member<typename member_pointer_class<decltype(Member)>::type>(Member))
+);
+
+} // namespace detail
+
 /**
  * @brief Retrieves the member function at the specified index of the given type.
  *
@@ -0,0 +1,184 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file transform_columns.hpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Column wise SIMD kernels
+ *
+ * Runs a kernel over batches of contiguous member columns, loading them
+ * into SIMD registers when the standard library provides them
+ */
+#pragma once
+
+#include <rflect/introspection/struct.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <utility>
+
+#if __has_include(<experimental/simd>)
+#include <experimental/simd>
+#endif
+
+#if defined(__cpp_lib_experimental_parallel_simd)
+#define RFLECT_HAS_SIMD 1
+#else
+#define RFLECT_HAS_SIMD 0
+#endif
+
+namespace rflect {
+
+namespace detail {
+
+#if RFLECT_HAS_SIMD
+namespace stdx = std::experimental;
+
+/**
+ * Elements per batch shared by all columns, the narrowest native register among the column types
+ */
+template<typename... Ts>
+inline constexpr std::size_t batch_width = std::min({stdx::native_simd<std::remove_const_t<Ts>>::size()...});
+
+template<std::size_t Width, typename T, typename Flags = stdx::element_aligned_tag>
+auto load_batch(T* const data, Flags const flags = {}) {
+  return stdx::fixed_size_simd<std::remove_const_t<T>, Width>(data, flags);
+}
+
+template<typename T, typename Batch, typename Flags = stdx::element_aligned_tag>
+void store_batch(Batch const& batch, T* const data, Flags const flags = {}) {
+  if constexpr (not std::is_const_v<T>) {
+    batch.copy_to(data, flags);
+  }
+}
+
+/**
+ * Column alignment of a `multi_vector` with aligned columns, or of the one under an aligned SoA `dual_vector`
+ */
+template<typename Container>
+consteval std::size_t column_alignment() {
+  if constexpr (requires { Container::column_alignment; }) {
+    return Container::column_alignment;
+  }
+  else {
+    return Container::underlying_container::column_alignment;
+  }
+}
+
+/**
+ * Element type of the padded column of `Member`, const for const containers
+ */
+template<typename Container, auto Member>
+using padded_element = typename decltype(std::declval<Container&>()
+                                             .template padded_items<member_name<Member>>())::element_type;
+
+/**
+ * Whether every batch of columns of `Ts` allocated with `Container` alignment can be loaded with `vector_aligned`
+ */
+template<typename Container, typename... Ts>
+consteval bool aligned_batches() {
+  if constexpr ((std::is_arithmetic_v<Ts> and ...)) {
+    constexpr auto width = batch_width<Ts...>;
+    return ((stdx::memory_alignment_v<stdx::fixed_size_simd<std::remove_const_t<Ts>, width>> <=
+             column_alignment<std::remove_const_t<Container>>()) and
+            ...);
+  }
+  else {
+    return false;
+  }
+}
+
+/**
+ * Runs `fn` over the first `size` elements of columns padded to a whole number of batches (see
+ * `multi_vector::padded_items`). Every batch, the last one included, is a full aligned load, so there is neither
+ * peeling nor a scalar remainder: the lanes past `size` hold padding
+ */
+template<typename Fn, typename... Ts>
+void transform_padded_spans(Fn& fn, std::size_t const size, std::span<Ts>... columns) {
+  constexpr auto width = batch_width<Ts...>;
+  assert(((columns.size() >= (size + width - 1) / width * width) and ...));
+  for (std::size_t i = 0; i < size; i += width) {
+    auto batches = std::make_tuple(load_batch<width>(columns.data() + i, stdx::vector_aligned)...);
+    std::apply(fn, batches);
+    std::apply([&](auto const&... batch) { (store_batch(batch, columns.data() + i, stdx::vector_aligned), ...); },
+               batches);
+  }
+}
+#endif
+
+} // namespace detail
+
+/**
+ * @brief Runs `fn` over the elements of several contiguous columns at once.
+ *
+ * When every column holds arithmetic values and `std::experimental::simd` is available, `fn` receives one SIMD
+ * batch per column (by reference, batches of non const columns are stored back). The remaining elements, and every
+ * element when SIMD is not available, are passed as scalar references. `fn` must therefore be generic, e.g.
+ * `[](auto& x, auto const& y) { x *= y; }`. Only the first `min(columns.size()...)` elements are visited.
+ *
+ * @param fn Kernel invoked with one batch (or element) per column
+ * @param columns Columns to be processed
+ */
+template<typename Fn, typename... Ts>
+void transform_spans(Fn fn, std::span<Ts>... columns) {
+  auto const size = std::min({columns.size()...});
+  std::size_t i   = 0;
+
+#if RFLECT_HAS_SIMD
+  if constexpr ((std::is_arithmetic_v<Ts> and ...)) {
+    constexpr auto width = detail::batch_width<Ts...>;
+    for (; i + width <= size; i += width) {
+      auto batches = std::make_tuple(detail::load_batch<width>(columns.data() + i)...);
+      std::apply(fn, batches);
+      std::apply([&](auto const&... batch) { (detail::store_batch(batch, columns.data() + i), ...); }, batches);
+    }
+  }
+#endif
+
+  for (; i < size; ++i) {
+    std::invoke(fn, columns[i]...);
+  }
+}
+
+/**
+ * @brief Runs `fn` over the selected member columns of a structure of arrays container.
+ *
+ * ```cpp
+ * rflect::transform_columns<&Complex::real, &Complex::imag>(numbers, [](auto& real, auto const& imag) {
+ *   real *= imag;
+ * });
+ * ```
+ *
+ * Columns with aligned, padded storage (`multi_vector` with a column alignment, `layout::aligned_soa`) are walked in
+ * aligned full batches over their padding when the alignment covers a batch, so `fn` also sees the padding lanes of
+ * the last batch and there is no scalar remainder. Stores to those lanes are harmless, but `fn` must not rely on their
+ * values.
+ *
+ * @tparam Members Pointers to the data members whose columns are processed, in the order `fn` receives them
+ * @param container `multi_vector`, `packed_multi_vector`, `multi_array` or SoA `dual_vector`/`dual_array`
+ * @param fn Kernel, see `transform_spans`
+ */
+template<auto... Members, typename Container, typename Fn>
+  requires(sizeof...(Members) > 0)
+void transform_columns(Container& container, Fn fn) {
+#if RFLECT_HAS_SIMD
+  if constexpr ((requires { container.template padded_items<detail::member_name<Members>>(); } and ...)) {
+    if constexpr (detail::aligned_batches<Container, detail::padded_element<Container, Members>...>()) {
+      detail::transform_padded_spans(fn, container.size(),
+                                     container.template padded_items<detail::member_name<Members>>()...);
+      return;
+    }
+  }
+#endif
+
+  auto const column = [](auto&& items) { return std::span(std::ranges::data(items), std::ranges::size(items)); };
+  transform_spans(fn, column(container.template items<detail::member_name<Members>>())...);
+}
+
+} // namespace rflect
@@ -0,0 +1,118 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file worker_pool.hpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Persistent worker threads shared by the parallel algorithms
+ *
+ * Threads are started once and wait on a barrier for work, so parallel
+ * algorithms do not start new threads on every call
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace rflect {
+
+namespace detail {
+
+/**
+ * @brief Team of threads waiting on a barrier for jobs, the calling thread taking part as thread 0.
+ *
+ * A job asks for any number of workers: thread `t` runs workers `t`, `t + size()`, ... in turn, so how a job splits its
+ * work does not depend on the size of the pool. Jobs run one at a time: a job submitted while another one is running
+ * (from another thread, or from inside a job) runs all of its workers on the submitting thread instead of waiting.
+ *
+ * @note Jobs must not throw when they run on the team, an exception escaping a worker terminates the program.
+ */
+class worker_pool {
+public:
+  explicit worker_pool(std::size_t const threads) : threads_(threads), sync_(static_cast<std::ptrdiff_t>(threads)) {
+    team_.reserve(threads - 1);
+    for (std::size_t thread = 1; thread < threads; ++thread) {
+      team_.emplace_back([this, thread] { work(thread); });
+    }
+  }
+
+  worker_pool(worker_pool const&) = delete;
+
+  worker_pool& operator=(worker_pool const&) = delete;
+
+  ~worker_pool() {
+    stop_ = true;
+    sync_.arrive_and_wait();
+    team_.clear();
+  }
+
+  /**
+   * Invokes `fn(worker)` for every worker in `[0, workers)` and returns once all of them are done
+   */
+  template<typename Fn>
+  void run(std::size_t const workers, Fn const& fn) {
+    if (workers <= 1 or threads_ == 1 or busy_.exchange(true)) {
+      for (std::size_t worker = 0; worker < workers; ++worker) {
+        fn(worker);
+      }
+      return;
+    }
+
+    auto const job = [this, &fn, workers](std::size_t const thread) noexcept {
+      for (auto worker = thread; worker < workers; worker += threads_) {
+        fn(worker);
+      }
+    };
+    job_    = &job;
+    invoke_ = &invoke<decltype(job)>;
+    sync_.arrive_and_wait(); // Start of the job
+    job(0);
+    sync_.arrive_and_wait(); // Every thread is done
+    busy_.store(false);
+  }
+
+  [[nodiscard]] std::size_t size() const noexcept { return threads_; }
+
+private:
+  template<typename Job>
+  static void invoke(void const* const job, std::size_t const thread) noexcept {
+    (*static_cast<Job const*>(job))(thread);
+  }
+
+  void work(std::size_t const thread) {
+    while (true) {
+      sync_.arrive_and_wait();
+      if (stop_) {
+        return;
+      }
+      invoke_(job_, thread);
+      sync_.arrive_and_wait();
+    }
+  }
+
+  std::size_t threads_;
+  std::barrier<> sync_;
+  void const* job_                          = nullptr;
+  void (*invoke_)(void const*, std::size_t) = nullptr;
+  std::atomic<bool> busy_                   = false;
+  bool stop_                                = false;
+  std::vector<std::jthread> team_;
+};
+
+/**
+ * Pool shared by every parallel algorithm, one thread per hardware thread, started on first use
+ */
+inline worker_pool& shared_pool() {
+  static worker_pool pool(std::max(1U, std::thread::hardware_concurrency()));
+  return pool;
+}
+
+} // namespace detail
+
+} // namespace rflect
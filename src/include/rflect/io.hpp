@@ -0,0 +1,16 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file io.hpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Input/output headers
+ *
+ * Not part of `rflect/rflect.hpp`: memory mapped files need POSIX headers
+ */
+#pragma once
+
+#include <rflect/io/column_file.hpp>
+#include <rflect/io/mapped_file.hpp>
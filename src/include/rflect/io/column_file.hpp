@@ -0,0 +1,308 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file column_file.hpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Columnar file format
+ *
+ * Saves structure of arrays containers to a columnar file whose header is
+ * generated from reflection, and maps it back without copying
+ */
+#pragma once
+
+#include <rflect/converters/struct_to_soa.hpp>
+#include <rflect/converters/to_static.hpp>
+#include <rflect/introspection/struct.hpp>
+#include <rflect/io/mapped_file.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <ranges>
+#include <stdexcept>
+#include <string_view>
+
+namespace rflect {
+
+namespace detail {
+
+inline constexpr std::array<char, 8> column_file_magic    = {'R', 'F', 'L', 'C', 'O', 'L', 'S', '\0'};
+inline constexpr std::uint32_t column_file_version        = 1;
+inline constexpr std::uint64_t column_file_alignment      = 4096;
+inline constexpr std::size_t column_file_identifier_limit = 64;
+
+struct column_file_header {
+  std::array<char, 8> magic;
+  std::uint32_t version;
+  std::uint32_t columns;
+  std::uint64_t rows;
+};
+
+struct column_header {
+  std::array<char, column_file_identifier_limit> name; // Member identifier, null terminated (truncated)
+  std::array<char, column_file_identifier_limit> type; // Member type as displayed by reflection (truncated)
+  std::uint64_t element_size;
+  std::uint64_t offset; // From the beginning of the file, multiple of column_file_alignment
+  std::uint64_t bytes;
+
+  friend constexpr bool operator==(column_header const&, column_header const&) = default;
+};
+
+template<typename T>
+inline constexpr std::size_t column_count =
+    (nonstatic_data_members_of(^^T, std::meta::access_context::unchecked())).size();
+
+consteval std::array<char, column_file_identifier_limit> fixed_string(std::string_view const text) {
+  std::array<char, column_file_identifier_limit> result {};
+  std::ranges::copy(text.substr(0, result.size() - 1), result.begin());
+  return result;
+}
+
+/**
+ * Headers of the columns of `T` in declaration order, offsets are filled in by `layout_columns`
+ */
+template<typename T>
+consteval std::array<column_header, column_count<T>> describe_columns() {
+  std::array<column_header, column_count<T>> headers {};
+  auto const members = nonstatic_data_members_of(^^T, std::meta::access_context::unchecked());
+  for (std::size_t i = 0; i < members.size(); ++i) {
+    headers[i].name         = fixed_string(identifier_of(members[i]));
+    headers[i].type         = fixed_string(display_string_of(type_of(members[i])));
+    headers[i].element_size = size_of(type_of(members[i]));
+  }
+  return headers;
+}
+
+constexpr std::uint64_t align_up(std::uint64_t const value, std::uint64_t const alignment) {
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+/**
+ * Headers of the columns of `T` for a file holding `rows` elements. Every column starts on a page boundary so it can
+ * also be mapped on its own
+ */
+template<typename T>
+constexpr std::array<column_header, column_count<T>> layout_columns(std::uint64_t const rows) {
+  auto headers = describe_columns<T>();
+  auto offset  = align_up(sizeof(column_file_header) + sizeof(headers), column_file_alignment);
+  for (auto& header: headers) {
+    header.offset = offset;
+    header.bytes  = header.element_size * rows;
+    offset        = align_up(offset + header.bytes, column_file_alignment);
+  }
+  return headers;
+}
+
+/**
+ * Bytes taken by one element across every column
+ */
+template<typename T>
+consteval std::uint64_t row_bytes() {
+  std::uint64_t bytes = 0;
+  for (auto const& header: describe_columns<T>()) {
+    bytes += header.element_size;
+  }
+  return bytes;
+}
+
+template<typename T>
+consteval bool trivially_copyable_members() {
+  return std::ranges::all_of(
+      nonstatic_data_members_of(^^T, std::meta::access_context::unchecked()),
+      [](std::meta::info const member) { return is_trivially_copyable_type(type_of(member)); }
+  );
+}
+
+inline void write_bytes(std::ofstream& file, std::span<std::byte const> const bytes) {
+  file.write(reinterpret_cast<char const*>(bytes.data()), static_cast<std::streamsize>(bytes.size())); // NOLINT
+}
+
+inline void pad_to(std::ofstream& file, std::uint64_t const offset) {
+  static constexpr std::array<char, column_file_alignment> zeros {};
+  auto const position = static_cast<std::uint64_t>(file.tellp());
+  file.write(zeros.data(), static_cast<std::streamsize>(offset - position));
+}
+
+} // namespace detail
+
+/**
+ * Aggregates whose members can be stored as raw columns
+ */
+template<typename T>
+concept column_storable = std::is_aggregate_v<T> and detail::trivially_copyable_members<T>();
+
+/**
+ * @brief Writes every member column of a structure of arrays container to `path`.
+ *
+ * The file starts with a `detail::column_file_header` (magic, version, column and row counts) followed by one
+ * `detail::column_header` per member (name, type, element size, offset and byte count), all generated from
+ * reflection. Columns follow, stored raw in native byte order, each one starting on a page boundary.
+ *
+ * @param container `multi_vector`, `packed_multi_vector`, `multi_array` or SoA `dual_vector`/`dual_array`
+ * @param path Destination file, truncated if it exists
+ * @throws std::ios_base::failure if the file cannot be written
+ */
+template<typename Container>
+  requires(column_storable<typename Container::value_type>)
+void save_columns(Container const& container, std::filesystem::path const& path) {
+  using value_type = typename Container::value_type;
+  using spans_type = std::remove_const_t<decltype(container.spans())>;
+
+  auto const spans   = container.spans();
+  auto const headers = detail::layout_columns<value_type>(container.size());
+  detail::column_file_header const header {
+    .magic   = detail::column_file_magic,
+    .version = detail::column_file_version,
+    .columns = static_cast<std::uint32_t>(headers.size()),
+    .rows    = container.size(),
+  };
+
+  std::ofstream file;
+  file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+  file.open(path, std::ios::binary | std::ios::trunc);
+  detail::write_bytes(file, std::as_bytes(std::span(&header, 1)));
+  detail::write_bytes(file, std::as_bytes(std::span(headers)));
+  template for (constexpr auto index: std::views::iota(0UZ, detail::column_count<value_type>)) {
+    detail::pad_to(file, headers[index].offset);
+    detail::write_bytes(file, std::as_bytes(spans.[:nonstatic_data_member<spans_type>(index):]));
+  }
+}
+
+/**
+ * @brief Read only, zero copy view over a file written by `save_columns`.
+ *
+ * The file is memory mapped and its header checked against the reflected layout of `T` (member names, types, sizes
+ * and offsets). Columns are then handed out as `std::span`s pointing straight into the mapping, so opening a file is
+ * constant time and pages are only read when a column is touched.
+ *
+ * @tparam T Aggregate type the file was written from
+ * @throws std::system_error if the file cannot be mapped, std::runtime_error if it does not hold columns of `T`
+ */
+template<typename T>
+  requires(column_storable<T>)
+class column_view {
+public:
+  /**********************************
+   *          Member types          *
+   **********************************/
+  using value_type = T;
+  using size_type  = std::size_t;
+  using spans_type = struct_of_spans<T const>;
+
+  /**********************************
+   *        Member functions        *
+   **********************************/
+
+  // ********* Constructors *********
+
+  explicit column_view(std::filesystem::path const& path) : file_(path) {
+    auto const bytes = file_.bytes();
+
+    detail::column_file_header header {};
+    if (bytes.size() < sizeof(header)) {
+      throw std::runtime_error(std::format("{}: not a column file", path.string()));
+    }
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    if (header.magic != detail::column_file_magic or header.version != detail::column_file_version) {
+      throw std::runtime_error(std::format("{}: not a column file (version {})", path.string(), header.version));
+    }
+
+    // Every row is stored in the mapping, so bounding `rows` by it keeps the column sizes and offsets from overflowing
+    if (header.rows > bytes.size() / detail::row_bytes<T>()) {
+      throw std::runtime_error(
+          std::format("{}: {} rows do not fit in {} bytes", path.string(), header.rows, bytes.size())
+      );
+    }
+
+    auto const expected = detail::layout_columns<T>(header.rows);
+    if (header.columns != expected.size() or bytes.size() < sizeof(header) + sizeof(expected)) {
+      throw std::runtime_error(
+          std::format("{}: holds {} columns, expected {}", path.string(), header.columns, expected.size())
+      );
+    }
+
+    std::array<detail::column_header, detail::column_count<T>> stored {};
+    std::memcpy(stored.data(), bytes.data() + sizeof(header), sizeof(stored));
+    for (std::size_t i = 0; i < stored.size(); ++i) {
+      if (stored[i] != expected[i]) {
+        throw std::runtime_error(std::format(
+            "{}: column '{}' ({}) does not match member '{}' ({})", path.string(), stored[i].name.data(),
+            stored[i].type.data(), expected[i].name.data(), expected[i].type.data()
+        ));
+      }
+      if (stored[i].offset + stored[i].bytes > bytes.size()) {
+        throw std::runtime_error(std::format("{}: column '{}' is truncated", path.string(), stored[i].name.data()));
+      }
+      offsets_[i] = stored[i].offset;
+    }
+    size_ = header.rows;
+  }
+
+  // ********* Element access *********
+
+  template<std::size_t N>
+  [[nodiscard]] auto items() const {
+    return spans().[:nonstatic_data_member<spans_type>(N):];
+  }
+
+  template<char const* name>
+  [[nodiscard]] auto items() const {
+    return spans().[:nonstatic_data_member<spans_type>(name):];
+  }
+
+  /**
+   * Structure of spans over every column, pointing into the mapping
+   */
+  [[nodiscard]] spans_type spans() const {
+    spans_type spans {};
+    template for (constexpr auto index: std::views::iota(0UZ, detail::column_count<T>)) {
+      using element_type = typename[:type_of(nonstatic_data_member<T>(index)):];
+      auto const* column = reinterpret_cast<element_type const*>(file_.data() + offsets_[index]); // NOLINT
+      spans.[:nonstatic_data_member<spans_type>(index):] = std::span(column, size_);
+    }
+    return spans;
+  }
+
+  // ********* Capacity *********
+
+  [[nodiscard]] size_type size() const noexcept { return size_; }
+
+  [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+private:
+  mapped_file file_;
+  std::array<std::uint64_t, detail::column_count<T>> offsets_ {};
+  size_type size_ {};
+};
+
+/**
+ * @brief Loads a file written by `save_columns` into a new structure of arrays container, one column copy at a time.
+ *
+ * Use `column_view` instead to read the columns in place.
+ *
+ * @tparam Container `multi_vector`, `packed_multi_vector` or SoA `dual_vector`
+ */
+template<typename Container>
+  requires(column_storable<typename Container::value_type>)
+Container load_columns(std::filesystem::path const& path) {
+  using value_type = typename Container::value_type;
+
+  column_view<value_type> const view(path);
+  Container container(view.size());
+  auto const source = view.spans();
+  auto target       = container.spans();
+  template for (constexpr auto index: std::views::iota(0UZ, detail::column_count<value_type>)) {
+    constexpr auto column = nonstatic_data_member<decltype(target)>(index);
+    constexpr auto mapped = nonstatic_data_member<typename column_view<value_type>::spans_type>(index);
+    std::ranges::copy(source.[:mapped:], target.[:column:].begin());
+  }
+  return container;
+}
+
+} // namespace rflect
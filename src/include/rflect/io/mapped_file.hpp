@@ -0,0 +1,107 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file mapped_file.hpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Read only memory mapped file
+ *
+ * RAII owner of a read only POSIX memory mapping of a whole file
+ */
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace rflect {
+
+/**
+ * @brief Read only memory mapping of a whole file.
+ *
+ * Pages are loaded lazily by the kernel on first access, so opening a file is constant time whatever its size and
+ * its contents are never copied into user buffers. The mapping stays valid until the object is destroyed.
+ *
+ * @throws std::system_error if the file cannot be opened, queried or mapped.
+ */
+class mapped_file {
+public:
+  // ********* Constructors *********
+
+  constexpr mapped_file() = default;
+
+  explicit mapped_file(std::filesystem::path const& path) {
+    int const descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC); // NOLINT
+    if (descriptor < 0) {
+      throw std::system_error(errno, std::generic_category(), path.string());
+    }
+
+    struct stat info {};
+    if (::fstat(descriptor, &info) < 0) {
+      auto const error = errno;
+      ::close(descriptor);
+      throw std::system_error(error, std::generic_category(), path.string());
+    }
+
+    size_ = static_cast<std::size_t>(info.st_size);
+    if (size_ > 0) {
+      void* const data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, descriptor, 0);
+      auto const error = errno;
+      ::close(descriptor);
+      if (data == MAP_FAILED) { // NOLINT
+        throw std::system_error(error, std::generic_category(), path.string());
+      }
+      data_ = static_cast<std::byte const*>(data);
+    }
+    else {
+      ::close(descriptor);
+    }
+  }
+
+  mapped_file(mapped_file const&) = delete;
+
+  mapped_file(mapped_file&& other) noexcept :
+    data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)) { }
+
+  mapped_file& operator=(mapped_file const&) = delete;
+
+  mapped_file& operator=(mapped_file&& other) noexcept {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    return *this;
+  }
+
+  ~mapped_file() {
+    if (data_ != nullptr) {
+      ::munmap(const_cast<std::byte*>(data_), size_); // NOLINT
+    }
+  }
+
+  // ********* Element access *********
+
+  [[nodiscard]] std::span<std::byte const> bytes() const noexcept { return {data_, size_}; }
+
+  [[nodiscard]] std::byte const* data() const noexcept { return data_; }
+
+  // ********* Capacity *********
+
+  [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+  [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+private:
+  std::byte const* data_ {};
+  std::size_t size_ {};
+};
+
+} // namespace rflect
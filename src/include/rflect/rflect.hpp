@@ -7,6 +7,8 @@
  * @version 1.0
  * @date 4/4/25
  * @brief Reflect headers
+ *
+ * `rflect/io.hpp` is not included, it depends on POSIX headers (mmap)
  */
 #pragma once
 
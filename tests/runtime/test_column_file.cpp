@@ -0,0 +1,115 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file test_column_file.cpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Tests for the columnar file format (save_columns, column_view, load_columns)
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "test_containers.hpp"
+
+#include <rflect/io.hpp>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+
+using namespace rflect;
+
+struct Renamed {
+  std::int32_t id;
+  std::double_t mass;
+  std::array<std::double_t, 3> velocity;
+};
+
+constexpr auto density_field = std::define_static_string("density");
+
+std::filesystem::path temporary_file(std::string_view const name) {
+  return std::filesystem::temp_directory_path() / std::format("rflect_{}_{}.cols", name, ::getpid());
+}
+
+TEST_SUITE_BEGIN("Column file");
+
+TEST_CASE("Header describes every member") {
+  constexpr auto headers = detail::layout_columns<Mock>(10);
+
+  CHECK(std::string_view(headers[0].name.data()) == "id");
+  CHECK(std::string_view(headers[2].name.data()) == "velocity");
+  CHECK(headers[1].element_size == sizeof(Mock::density));
+  CHECK(headers[1].bytes == 10 * sizeof(Mock::density));
+  for (auto const& header: headers) {
+    CHECK(header.offset % detail::column_file_alignment == 0U);
+  }
+}
+
+TEST_CASE("column_view maps the saved columns") {
+  auto const path = temporary_file("view");
+  multi_vector<Mock> const mocks {mock_0, mock_1, mock_2, mock_3};
+  save_columns(mocks, path);
+
+  {
+    column_view<Mock> const view(path);
+    CHECK(view.size() == 4U);
+    CHECK(view.items<0>()[2] == mock_2.id);
+    CHECK(view.items<density_field>()[3] == mock_3.density);
+    CHECK(view.spans().velocity[0] == mock_0.velocity);
+  }
+  std::filesystem::remove(path);
+}
+
+TEST_CASE("load_columns round trips through dual_vector") {
+  auto const path = temporary_file("load");
+  dual_vector<Mock, layout::soa> const mocks {mock_0, mock_1, mock_2};
+  save_columns(mocks, path);
+
+  auto const loaded = load_columns<dual_vector<Mock, layout::soa>>(path);
+  CHECK(loaded == mocks);
+
+  auto const packed = load_columns<packed_multi_vector<Mock>>(path);
+  CHECK(packed == packed_multi_vector<Mock> {mock_0, mock_1, mock_2});
+  std::filesystem::remove(path);
+}
+
+TEST_CASE("Empty containers") {
+  auto const path = temporary_file("empty");
+  save_columns(multi_vector<Mock> {}, path);
+
+  column_view<Mock> const view(path);
+  CHECK(view.empty() == true);
+  CHECK(view.items<0>().empty() == true);
+  std::filesystem::remove(path);
+}
+
+TEST_CASE("Mismatching types are rejected") {
+  auto const path = temporary_file("mismatch");
+  save_columns(multi_vector<Mock> {mock_0}, path);
+
+  CHECK_THROWS_AS(column_view<Renamed> {path}, std::runtime_error);
+  CHECK_THROWS_AS(column_view<Mock> {temporary_file("missing")}, std::system_error);
+  std::filesystem::remove(path);
+}
+
+TEST_CASE("Row counts larger than the file are rejected") {
+  auto const path = temporary_file("rows");
+  save_columns(multi_vector<Mock> {mock_0}, path);
+
+  // Overflows 64 bits once multiplied by the size of any member
+  auto const rows = std::numeric_limits<std::uint64_t>::max() / 2;
+  {
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(offsetof(detail::column_file_header, rows));
+    file.write(reinterpret_cast<char const*>(&rows), sizeof(rows)); // NOLINT
+  }
+
+  CHECK_THROWS_AS(column_view<Mock> {path}, std::runtime_error);
+  std::filesystem::remove(path);
+}
+
+TEST_SUITE_END();
@@ -15,6 +15,8 @@
 
 #include <rflect/containers.hpp>
 
+#include <memory_resource>
+
 struct Mock {
   DEFINE_PROXY(id, density, velocity);
 
@@ -82,3 +84,38 @@ void test_element_access() {
     CHECK(mock[2] == mock_2);
   }
 }
+
+/**
+ * Container of `size` distinct mocks, the mock `i` having id `i`, density `i / 2` and velocity `{i, 0, -i}`
+ */
+template<typename Container>
+Container make_mocks(std::size_t const size) {
+  Container mocks;
+  for (std::size_t i = 0; i < size; ++i) {
+    auto const value = static_cast<std::double_t>(i);
+    mocks.push_back(Mock {.id = static_cast<std::int32_t>(i), .density = value / 2, .velocity = {value, 0.0, -value}});
+  }
+  return mocks;
+}
+
+/**
+ * Memory resource counting the allocations it forwards to the default resource
+ */
+class counting_resource : public std::pmr::memory_resource {
+public:
+  std::size_t allocations = 0;
+
+private:
+  void* do_allocate(std::size_t const bytes, std::size_t const alignment) override {
+    ++allocations;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* const pointer, std::size_t const bytes, std::size_t const alignment) override {
+    std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+  }
+
+  [[nodiscard]] bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override {
+    return this == &other;
+  }
+};
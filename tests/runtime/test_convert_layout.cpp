@@ -0,0 +1,84 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file test_convert_layout.cpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Tests for the blocked AoS <-> SoA layout conversion
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "test_containers.hpp"
+
+#include <rflect/introspection/convert_layout.hpp>
+
+#include <array>
+
+using namespace rflect;
+
+namespace {
+
+// Spans several transpose blocks and does not end on a block boundary
+constexpr std::size_t mocks_count = 1000;
+
+template<typename Layout>
+using mocks_in = dual_vector<Mock, Layout>;
+
+template<typename To, typename Container>
+concept convertible_to_layout = requires(Container const& container) { convert_layout<To>(container); };
+
+} // namespace
+
+TEST_SUITE_BEGIN("Convert layout");
+
+TEST_CASE("Transpose blocks are whole cache lines") {
+  CHECK(detail::transpose_block<Mock>() % detail::elements_per_line<Mock>() == 0U);
+  CHECK(detail::transpose_block<Mock>() * sizeof(Mock) <= detail::transpose_block_bytes);
+}
+
+TEST_CASE_TEMPLATE("Array of structures to structure of arrays", Layout, layout::soa, layout::packed_soa) {
+  auto const mocks    = make_mocks<mocks_in<layout::aos>>(mocks_count);
+  auto const expected = make_mocks<mocks_in<Layout>>(mocks_count);
+
+  CHECK(convert_layout<Layout>(mocks) == expected);
+  CHECK(convert_layout<Layout>(execution::parallel_policy {.threads = 4}, mocks) == expected);
+}
+
+TEST_CASE_TEMPLATE("Structure of arrays to array of structures", Layout, layout::soa, layout::packed_soa) {
+  auto const mocks    = make_mocks<mocks_in<Layout>>(mocks_count);
+  auto const expected = make_mocks<mocks_in<layout::aos>>(mocks_count);
+
+  CHECK(convert_layout<layout::aos>(mocks) == expected);
+  CHECK(convert_layout<layout::aos>(execution::parallel_policy {.threads = 4}, mocks) == expected);
+}
+
+TEST_CASE_TEMPLATE("Result uses the allocator of the source", Layout, layout::soa, layout::packed_soa) {
+  counting_resource resource;
+  pmr::dual_vector<Mock, layout::aos> mocks(&resource);
+  mocks.append_range(std::array {mock_0, mock_1, mock_2});
+
+  auto const soa = convert_layout<Layout>(mocks);
+  CHECK(soa.get_allocator().resource() == &resource);
+  CHECK(convert_layout<layout::aos>(soa) == mocks);
+  CHECK(convert_layout<layout::aos>(soa).get_allocator().resource() == &resource);
+}
+
+TEST_CASE("Empty containers") {
+  dual_vector<Mock, layout::aos> const mocks;
+  CHECK(convert_layout<layout::soa>(mocks).empty());
+  CHECK(convert_layout<layout::aos>(execution::par, dual_vector<Mock, layout::soa> {}).empty());
+}
+
+TEST_CASE("Unsupported layout pairs") {
+  using aos_vector = dual_vector<Mock, layout::aos>;
+  static_assert(convertible_to_layout<layout::soa, aos_vector>);
+  static_assert(not convertible_to_layout<layout::aos, aos_vector>);
+  static_assert(not convertible_to_layout<layout::soa_flat, aos_vector>);
+  static_assert(not convertible_to_layout<layout::aosoa<4>, aos_vector>);
+}
+
+TEST_SUITE_END();
@@ -26,17 +26,17 @@ TEST_SUITE_BEGIN("Dual Array");
 
 // *** Constructors ***
 
-TEST_CASE_TEMPLATE("Default constructor", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("Default constructor", T, layout::aos, layout::soa, layout::aosoa<2>) {
   container<T> arr;
   CHECK(arr.size() == array_size);
 }
 
-TEST_CASE_TEMPLATE("Initializer list constructor", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("Initializer list constructor", T, layout::aos, layout::soa, layout::aosoa<2>) {
   container<T> arr {mock_0, mock_1, mock_2};
   CHECK(arr.size() == array_size);
 }
 
-TEST_CASE_TEMPLATE("Full initializer list", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("Full initializer list", T, layout::aos, layout::soa, layout::aosoa<2>) {
   dual_array<Mock, 4, T> arr {mock_0, mock_1, mock_2, mock_3};
   CHECK(arr.size() == 4U);
   CHECK(arr[0] == mock_0);
@@ -47,23 +47,25 @@ TEST_CASE_TEMPLATE("Full initializer list", T, layout::aos, layout::soa) {
 
 // *** Element access ***
 
-TEST_CASE_TEMPLATE("Element access", T, layout::aos, layout::soa) { test_element_access<container<T>>(); }
+TEST_CASE_TEMPLATE("Element access", T, layout::aos, layout::soa, layout::aosoa<2>) {
+  test_element_access<container<T>>();
+}
 
-TEST_CASE_TEMPLATE("front", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("front", T, layout::aos, layout::soa, layout::aosoa<2>) {
   dual_array<Mock, 4, T> arr {mock_0, mock_1, mock_2, mock_3};
 
   CHECK(arr.front() == mock_0);
   CHECK(arr.front() == arr.at(0));
 }
 
-TEST_CASE_TEMPLATE("back", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("back", T, layout::aos, layout::soa, layout::aosoa<2>) {
   dual_array<Mock, 4, T> arr {mock_0, mock_1, mock_2, mock_3};
 
   CHECK(arr.back() == mock_3);
   CHECK(arr.back() == arr.at(3));
 }
 
-TEST_CASE_TEMPLATE("front equals back on single-element array", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("front equals back on single-element array", T, layout::aos, layout::soa, layout::aosoa<2>) {
   dual_array<Mock, 1, T> arr {mock_2};
 
   CHECK(arr.front() == mock_2);
@@ -71,7 +73,7 @@ TEST_CASE_TEMPLATE("front equals back on single-element array", T, layout::aos,
   CHECK(arr.front() == arr.back());
 }
 
-TEST_CASE_TEMPLATE("at returns proxy that reads all fields", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("at returns proxy that reads all fields", T, layout::aos, layout::soa, layout::aosoa<2>) {
   dual_array<Mock, 4, T> arr {mock_0, mock_1, mock_2, mock_3};
 
   SUBCASE("id field") {
@@ -96,7 +98,7 @@ TEST_CASE_TEMPLATE("at returns proxy that reads all fields", T, layout::aos, lay
   }
 }
 
-TEST_CASE_TEMPLATE("proxy mutation via at", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("proxy mutation via at", T, layout::aos, layout::soa, layout::aosoa<2>) {
   dual_array<Mock, 4, T> arr {mock_0, mock_1, mock_2, mock_3};
 
   SUBCASE("modify id") {
@@ -118,7 +120,7 @@ TEST_CASE_TEMPLATE("proxy mutation via at", T, layout::aos, layout::soa) {
   }
 }
 
-TEST_CASE_TEMPLATE("proxy mutation via operator[]", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("proxy mutation via operator[]", T, layout::aos, layout::soa, layout::aosoa<2>) {
   dual_array<Mock, 4, T> arr {mock_0, mock_1, mock_2, mock_3};
 
   arr[0].id()      = 42;
@@ -129,7 +131,7 @@ TEST_CASE_TEMPLATE("proxy mutation via operator[]", T, layout::aos, layout::soa)
   CHECK(arr[1].id() == mock_1.id);
 }
 
-TEST_CASE_TEMPLATE("proxy assignment via at", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("proxy assignment via at", T, layout::aos, layout::soa, layout::aosoa<2>) {
   dual_array<Mock, 4, T> arr {mock_0, mock_1, mock_2, mock_3};
 
   arr.at(0) = mock_3;
@@ -140,7 +142,7 @@ TEST_CASE_TEMPLATE("proxy assignment via at", T, layout::aos, layout::soa) {
 
 // *** Capacity ***
 
-TEST_CASE_TEMPLATE("Capacity", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("Capacity", T, layout::aos, layout::soa, layout::aosoa<2>) {
   dual_array<Mock, 0, T> container_0;
   container<T> container_1 {mock_0, mock_1};
   container<T> container_2 {mock_0, mock_1, mock_2};
@@ -164,7 +166,7 @@ TEST_CASE_TEMPLATE("Capacity", T, layout::aos, layout::soa) {
   }
 }
 
-TEST_CASE_TEMPLATE("size equals max_size for fixed array", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("size equals max_size for fixed array", T, layout::aos, layout::soa, layout::aosoa<2>) {
   dual_array<Mock, 10, T> arr;
 
   CHECK(arr.size() == arr.max_size());
@@ -173,7 +175,7 @@ TEST_CASE_TEMPLATE("size equals max_size for fixed array", T, layout::aos, layou
 
 // *** Iterators ***
 
-TEST_CASE_TEMPLATE("Iterators", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("Iterators", T, layout::aos, layout::soa, layout::aosoa<2>) {
   static constexpr auto size = 4;
   dual_array<Mock, size> mock {mock_0, mock_1, mock_2, mock_3};
 
@@ -205,7 +207,7 @@ TEST_CASE_TEMPLATE("Iterators", T, layout::aos, layout::soa) {
   }
 }
 
-TEST_CASE_TEMPLATE("Iterator post-increment", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("Iterator post-increment", T, layout::aos, layout::soa, layout::aosoa<2>) {
   dual_array<Mock, 4, T> arr {mock_0, mock_1, mock_2, mock_3};
 
   auto it  = arr.begin();
@@ -214,7 +216,7 @@ TEST_CASE_TEMPLATE("Iterator post-increment", T, layout::aos, layout::soa) {
   CHECK((*it).id() == mock_1.id);
 }
 
-TEST_CASE_TEMPLATE("Iterator arithmetic", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("Iterator arithmetic", T, layout::aos, layout::soa, layout::aosoa<2>) {
   dual_array<Mock, 4, T> arr {mock_0, mock_1, mock_2, mock_3};
 
   auto begin = arr.begin();
@@ -237,7 +239,7 @@ TEST_CASE_TEMPLATE("Iterator arithmetic", T, layout::aos, layout::soa) {
   }
 }
 
-TEST_CASE_TEMPLATE("Iterator equality", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("Iterator equality", T, layout::aos, layout::soa, layout::aosoa<2>) {
   dual_array<Mock, 4, T> arr {mock_0, mock_1, mock_2, mock_3};
 
   CHECK(arr.begin() == arr.begin());
@@ -246,7 +248,7 @@ TEST_CASE_TEMPLATE("Iterator equality", T, layout::aos, layout::soa) {
   CHECK(arr.begin() + 4 == arr.end());
 }
 
-TEST_CASE_TEMPLATE("Iterator velocity field", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("Iterator velocity field", T, layout::aos, layout::soa, layout::aosoa<2>) {
   dual_array<Mock, 4, T> arr {mock_0, mock_1, mock_2, mock_3};
   std::size_t idx = 0;
 
@@ -259,7 +261,7 @@ TEST_CASE_TEMPLATE("Iterator velocity field", T, layout::aos, layout::soa) {
 
 // *** Range iteration ***
 
-TEST_CASE_TEMPLATE("Range iteration", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("Range iteration", T, layout::aos, layout::soa, layout::aosoa<2>) {
   static constexpr std::size_t size = 4;
   dual_array<Mock, size, T> mock {mock_0, mock_1, mock_2, mock_3};
 
@@ -274,7 +276,7 @@ TEST_CASE_TEMPLATE("Range iteration", T, layout::aos, layout::soa) {
   }
 }
 
-TEST_CASE_TEMPLATE("Range iteration reads velocity", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("Range iteration reads velocity", T, layout::aos, layout::soa, layout::aosoa<2>) {
   dual_array<Mock, 4, T> arr {mock_0, mock_1, mock_2, mock_3};
   std::array<Mock const*, 4> const mocks {&mock_0, &mock_1, &mock_2, &mock_3};
 
@@ -285,7 +287,7 @@ TEST_CASE_TEMPLATE("Range iteration reads velocity", T, layout::aos, layout::soa
   }
 }
 
-TEST_CASE_TEMPLATE("Range iteration mutates elements", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("Range iteration mutates elements", T, layout::aos, layout::soa, layout::aosoa<2>) {
   dual_array<Mock, 4, T> arr {mock_0, mock_1, mock_2, mock_3};
 
   for (auto elem: arr) {
@@ -299,7 +301,7 @@ TEST_CASE_TEMPLATE("Range iteration mutates elements", T, layout::aos, layout::s
 
 // *** Const correctness ***
 
-TEST_CASE_TEMPLATE("Const access", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("Const access", T, layout::aos, layout::soa, layout::aosoa<2>) {
   dual_array<Mock, 4, T> const arr {mock_0, mock_1, mock_2, mock_3};
 
   CHECK(arr.at(0) == mock_0);
@@ -311,7 +313,7 @@ TEST_CASE_TEMPLATE("Const access", T, layout::aos, layout::soa) {
   CHECK(arr.back() == mock_3);
 }
 
-TEST_CASE_TEMPLATE("Const iterator reads all fields", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("Const iterator reads all fields", T, layout::aos, layout::soa, layout::aosoa<2>) {
   dual_array<Mock, 4, T> const arr {mock_0, mock_1, mock_2, mock_3};
 
   std::int32_t expected_id = 0;
@@ -323,7 +325,7 @@ TEST_CASE_TEMPLATE("Const iterator reads all fields", T, layout::aos, layout::so
 
 // *** Algorithm compatibility ***
 
-TEST_CASE_TEMPLATE("std::find_if compatibility", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("std::find_if compatibility", T, layout::aos, layout::soa, layout::aosoa<2>) {
   dual_array<Mock, 4, T> arr {mock_0, mock_1, mock_2, mock_3};
 
   auto it = std::find_if(arr.begin(), arr.end(), [](auto const& elem) { return elem.id() == 2; });
@@ -332,7 +334,7 @@ TEST_CASE_TEMPLATE("std::find_if compatibility", T, layout::aos, layout::soa) {
   CHECK((*it).density() == mock_2.density);
 }
 
-TEST_CASE_TEMPLATE("std::count_if compatibility", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("std::count_if compatibility", T, layout::aos, layout::soa, layout::aosoa<2>) {
   dual_array<Mock, 4, T> arr {mock_0, mock_1, mock_2, mock_3};
 
   auto count = std::count_if(arr.begin(), arr.end(), [](auto const& elem) { return elem.id() >= 2; });
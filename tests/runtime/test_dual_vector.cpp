@@ -23,17 +23,17 @@ TEST_SUITE_BEGIN("Dual Vector");
 
 // *** Constructors ***
 
-TEST_CASE_TEMPLATE("Default constructor", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("Default constructor", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec;
   CHECK(vec.size() == 0U);
 }
 
-TEST_CASE_TEMPLATE("Explicit size constructor", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("Explicit size constructor", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec(4);
   CHECK(vec.size() == 4U);
 }
 
-TEST_CASE_TEMPLATE("Initializer list constructor", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("Initializer list constructor", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec {mock_0, mock_1, mock_2};
   CHECK(vec.size() == 3U);
 }
@@ -44,9 +44,20 @@ TEST_CASE("Deduction guide") {
   CHECK(vec[0] == mock_0);
 }
 
+TEST_CASE_TEMPLATE("Allocator constructor", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
+  counting_resource resource;
+  pmr::dual_vector<Mock, T> vec(&resource);
+  vec.push_back(mock_0);
+  vec.push_back(mock_1);
+
+  CHECK(vec.size() == 2U);
+  CHECK(vec[1] == mock_1);
+  CHECK(resource.allocations > 0U);
+}
+
 // *** Capacity ***
 
-TEST_CASE_TEMPLATE("size", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("size", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec_0;
   container<T> vec_1 {mock_0, mock_1};
   container<T> vec_2 {mock_0, mock_1, mock_2};
@@ -56,12 +67,14 @@ TEST_CASE_TEMPLATE("size", T, layout::aos, layout::soa) {
   CHECK(vec_2.size() == 3U);
 }
 
-TEST_CASE_TEMPLATE("empty on default-constructed vector", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE(
+    "empty on default-constructed vector", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>
+) {
   container<T> vec;
   CHECK(vec.size() == 0U);
 }
 
-TEST_CASE_TEMPLATE("empty after push_back", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("empty after push_back", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec;
   vec.push_back(mock_0);
   CHECK(vec.size() == 1U);
@@ -69,9 +82,11 @@ TEST_CASE_TEMPLATE("empty after push_back", T, layout::aos, layout::soa) {
 
 // *** Element access ***
 
-TEST_CASE_TEMPLATE("Accessors", T, layout::aos, layout::soa) { test_element_access<container<T>>(); }
+TEST_CASE_TEMPLATE(
+    "Accessors", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>
+) { test_element_access<container<T>>(); }
 
-TEST_CASE_TEMPLATE("operator[]", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("operator[]", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec {mock_0, mock_1, mock_2};
 
   CHECK(vec[0] == mock_0);
@@ -79,21 +94,23 @@ TEST_CASE_TEMPLATE("operator[]", T, layout::aos, layout::soa) {
   CHECK(vec[2] == mock_2);
 }
 
-TEST_CASE_TEMPLATE("front", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("front", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec {mock_0, mock_1, mock_2};
 
   CHECK(vec.front() == mock_0);
   CHECK(vec.front() == vec.at(0));
 }
 
-TEST_CASE_TEMPLATE("back", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("back", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec {mock_0, mock_1, mock_2};
 
   CHECK(vec.back() == mock_2);
   CHECK(vec.back() == vec.at(2));
 }
 
-TEST_CASE_TEMPLATE("front and back on single-element vector", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE(
+    "front and back on single-element vector", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>
+) {
   container<T> vec {mock_1};
 
   CHECK(vec.front() == mock_1);
@@ -101,7 +118,7 @@ TEST_CASE_TEMPLATE("front and back on single-element vector", T, layout::aos, la
   CHECK(vec.front() == vec.back());
 }
 
-TEST_CASE_TEMPLATE("at reads all fields", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("at reads all fields", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec {mock_0, mock_1, mock_2, mock_3};
 
   SUBCASE("id field") {
@@ -126,7 +143,7 @@ TEST_CASE_TEMPLATE("at reads all fields", T, layout::aos, layout::soa) {
   }
 }
 
-TEST_CASE_TEMPLATE("proxy mutation via at", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("proxy mutation via at", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec {mock_0, mock_1, mock_2, mock_3};
 
   SUBCASE("modify id") {
@@ -148,7 +165,7 @@ TEST_CASE_TEMPLATE("proxy mutation via at", T, layout::aos, layout::soa) {
   }
 }
 
-TEST_CASE_TEMPLATE("proxy mutation via operator[]", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("proxy mutation via operator[]", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec {mock_0, mock_1, mock_2};
 
   vec[0].id()      = 77;
@@ -159,7 +176,7 @@ TEST_CASE_TEMPLATE("proxy mutation via operator[]", T, layout::aos, layout::soa)
   CHECK(vec[1].id() == mock_1.id);
 }
 
-TEST_CASE_TEMPLATE("proxy assignment", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("proxy assignment", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec {mock_0, mock_1, mock_2};
 
   vec.at(0) = mock_3;
@@ -169,7 +186,7 @@ TEST_CASE_TEMPLATE("proxy assignment", T, layout::aos, layout::soa) {
   CHECK(vec.at(2) == mock_2);
 }
 
-TEST_CASE_TEMPLATE("Const access", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("Const access", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> const vec {mock_0, mock_1, mock_2};
 
   CHECK(vec.at(0) == mock_0);
@@ -179,7 +196,7 @@ TEST_CASE_TEMPLATE("Const access", T, layout::aos, layout::soa) {
 
 // *** Comparison ***
 
-TEST_CASE_TEMPLATE("Comparison", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("Comparison", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec1 {mock_0, mock_1, mock_2, mock_3};
   container<T> vec2 {mock_0, mock_1, mock_2, mock_3};
   container<T> vec3 {mock_0, mock_1, mock_2};
@@ -188,7 +205,7 @@ TEST_CASE_TEMPLATE("Comparison", T, layout::aos, layout::soa) {
   CHECK(vec1 != vec3);
 }
 
-TEST_CASE_TEMPLATE("Comparison after mutation", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("Comparison after mutation", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec1 {mock_0, mock_1, mock_2};
   container<T> vec2 {mock_0, mock_1, mock_2};
 
@@ -201,7 +218,7 @@ TEST_CASE_TEMPLATE("Comparison after mutation", T, layout::aos, layout::soa) {
 
 // *** Modifiers ***
 
-TEST_CASE_TEMPLATE("push_back value", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("push_back value", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec {mock_0, mock_1, mock_2};
   container<T> vec2;
   vec2.push_back(mock_0);
@@ -217,7 +234,7 @@ TEST_CASE_TEMPLATE("push_back value", T, layout::aos, layout::soa) {
   CHECK(vec == vec2);
 }
 
-TEST_CASE_TEMPLATE("push_back proxy view", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("push_back proxy view", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> source {mock_0, mock_1, mock_2, mock_3};
   container<T> dest;
 
@@ -228,7 +245,7 @@ TEST_CASE_TEMPLATE("push_back proxy view", T, layout::aos, layout::soa) {
   CHECK(dest == source);
 }
 
-TEST_CASE_TEMPLATE("push_back increases size", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("push_back increases size", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec;
 
   CHECK(vec.size() == 0U);
@@ -240,7 +257,7 @@ TEST_CASE_TEMPLATE("push_back increases size", T, layout::aos, layout::soa) {
   CHECK(vec.size() == 3U);
 }
 
-TEST_CASE_TEMPLATE("pop_back", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("pop_back", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec1 {mock_0, mock_1, mock_2, mock_3};
   container<T> vec2 {mock_0, mock_1, mock_2, mock_3};
   container<T> vec3 {mock_0, mock_1, mock_2};
@@ -252,7 +269,7 @@ TEST_CASE_TEMPLATE("pop_back", T, layout::aos, layout::soa) {
   CHECK(vec1 == vec2);
 }
 
-TEST_CASE_TEMPLATE("pop_back decreases size", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("pop_back decreases size", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec {mock_0, mock_1, mock_2, mock_3};
 
   CHECK(vec.size() == 4U);
@@ -262,7 +279,7 @@ TEST_CASE_TEMPLATE("pop_back decreases size", T, layout::aos, layout::soa) {
   CHECK(vec.size() == 2U);
 }
 
-TEST_CASE_TEMPLATE("pop_back then push_back", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("pop_back then push_back", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec {mock_0, mock_1, mock_2};
   container<T> expected {mock_0, mock_1, mock_3};
 
@@ -272,7 +289,7 @@ TEST_CASE_TEMPLATE("pop_back then push_back", T, layout::aos, layout::soa) {
   CHECK(vec == expected);
 }
 
-TEST_CASE_TEMPLATE("erase last element", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("erase last element", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec1 {mock_0, mock_1, mock_2, mock_3};
   container<T> vec2 {mock_0, mock_1, mock_2, mock_3};
   container<T> vec3 {mock_0, mock_1, mock_2};
@@ -286,7 +303,7 @@ TEST_CASE_TEMPLATE("erase last element", T, layout::aos, layout::soa) {
   CHECK(vec1 == vec2);
 }
 
-TEST_CASE_TEMPLATE("erase first element", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("erase first element", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec {mock_0, mock_1, mock_2, mock_3};
   container<T> expected {mock_1, mock_2, mock_3};
 
@@ -296,7 +313,7 @@ TEST_CASE_TEMPLATE("erase first element", T, layout::aos, layout::soa) {
   CHECK(vec.size() == 3U);
 }
 
-TEST_CASE_TEMPLATE("erase middle element", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("erase middle element", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec {mock_0, mock_1, mock_2, mock_3};
   container<T> expected {mock_0, mock_2, mock_3};
 
@@ -306,7 +323,9 @@ TEST_CASE_TEMPLATE("erase middle element", T, layout::aos, layout::soa) {
   CHECK(vec.size() == 3U);
 }
 
-TEST_CASE_TEMPLATE("erase returns iterator to next", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE(
+    "erase returns iterator to next", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>
+) {
   container<T> vec {mock_0, mock_1, mock_2, mock_3};
 
   auto it     = vec.erase(vec.begin() + 1);
@@ -316,9 +335,48 @@ TEST_CASE_TEMPLATE("erase returns iterator to next", T, layout::aos, layout::soa
   CHECK((*it).id() == mock_2.id);
 }
 
+TEST_CASE_TEMPLATE("append_range", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
+  container<T> vec {mock_0};
+  container<T> expected {mock_0, mock_1, mock_2, mock_3};
+  std::vector<Mock> const mocks {mock_1, mock_2, mock_3};
+
+  vec.append_range(mocks);
+
+  CHECK(vec.size() == 4U);
+  CHECK(vec == expected);
+}
+
+TEST_CASE_TEMPLATE("insert range", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
+  container<T> vec {mock_0, mock_3};
+  container<T> expected {mock_0, mock_1, mock_2, mock_3};
+  std::vector<Mock> const mocks {mock_1, mock_2};
+
+  auto it = vec.insert(vec.cbegin() + 1, mocks.begin(), mocks.end());
+
+  CHECK(vec == expected);
+  CHECK((*it).id() == mock_1.id);
+}
+
+TEST_CASE_TEMPLATE("reserve and resize", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
+  container<T> vec {mock_0, mock_1, mock_2};
+
+  vec.reserve(64);
+  CHECK(vec.capacity() >= 64U);
+  CHECK(vec.size() == 3U);
+
+  vec.resize(1);
+  CHECK(vec.size() == 1U);
+  CHECK(vec.at(0) == mock_0);
+
+  vec.resize(3);
+  CHECK(vec.size() == 3U);
+  CHECK(vec.at(2).id() == 0);
+  CHECK(vec.at(2).density() == 0.0);
+}
+
 // *** Iterators ***
 
-TEST_CASE_TEMPLATE("Vector proxy iterator", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("Vector proxy iterator", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec {mock_0, mock_1, mock_2, mock_3};
   constexpr auto vec_size = 4;
 
@@ -333,7 +391,7 @@ TEST_CASE_TEMPLATE("Vector proxy iterator", T, layout::aos, layout::soa) {
   }
 }
 
-TEST_CASE_TEMPLATE("Const iterator", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("Const iterator", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec {mock_0, mock_1, mock_2, mock_3};
 
   std::int32_t i  = 0;
@@ -345,7 +403,7 @@ TEST_CASE_TEMPLATE("Const iterator", T, layout::aos, layout::soa) {
   }
 }
 
-TEST_CASE_TEMPLATE("Const vector iterator", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("Const vector iterator", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> const vec {mock_0, mock_1, mock_2, mock_3};
 
   std::int32_t i = 0;
@@ -354,7 +412,7 @@ TEST_CASE_TEMPLATE("Const vector iterator", T, layout::aos, layout::soa) {
   }
 }
 
-TEST_CASE_TEMPLATE("Iterator post-increment", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("Iterator post-increment", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec {mock_0, mock_1, mock_2};
 
   auto it  = vec.begin();
@@ -363,7 +421,7 @@ TEST_CASE_TEMPLATE("Iterator post-increment", T, layout::aos, layout::soa) {
   CHECK((*it).id() == mock_1.id);
 }
 
-TEST_CASE_TEMPLATE("Iterator arithmetic", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("Iterator arithmetic", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec {mock_0, mock_1, mock_2, mock_3};
 
   auto begin = vec.begin();
@@ -386,7 +444,7 @@ TEST_CASE_TEMPLATE("Iterator arithmetic", T, layout::aos, layout::soa) {
   }
 }
 
-TEST_CASE_TEMPLATE("Iterator equality", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("Iterator equality", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec {mock_0, mock_1, mock_2};
 
   CHECK(vec.begin() == vec.begin());
@@ -395,9 +453,46 @@ TEST_CASE_TEMPLATE("Iterator equality", T, layout::aos, layout::soa) {
   CHECK(vec.begin() + 3 == vec.end());
 }
 
+TEST_CASE_TEMPLATE("Random access iterator", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
+  container<T> vec {mock_0, mock_1, mock_2, mock_3};
+
+  auto it = vec.begin();
+  CHECK(it[2] == mock_2);
+  CHECK((2 + it).index() == 2U);
+
+  it += 3;
+  CHECK(*it == mock_3);
+  CHECK((*--it).id() == mock_2.id);
+  it -= 2;
+  CHECK(*it == mock_0);
+
+  CHECK(vec.begin() < vec.end());
+  CHECK(vec.end() >= vec.begin() + 4);
+  CHECK(std::ranges::distance(vec) == 4);
+  CHECK((*std::ranges::prev(vec.end())).id() == mock_3.id);
+}
+
+TEST_CASE_TEMPLATE("Member spans", T, layout::soa, layout::packed_soa) {
+  constexpr auto density_field = std::define_static_string("density");
+  container<T> vec {mock_0, mock_1, mock_2, mock_3};
+
+  auto densities = vec.template items<density_field>();
+  CHECK(densities.size() == 4U);
+  CHECK(densities[3] == mock_3.density);
+
+  auto const first = vec.begin() + 1;
+  auto const last  = vec.begin() + 3;
+  auto const chunk = vec.spans().id.subspan(first.index(), static_cast<std::size_t>(last - first));
+  CHECK(chunk.size() == 2U);
+  CHECK(chunk[0] == mock_1.id);
+
+  densities[0] = -1.0;
+  CHECK(vec.at(0).density() == -1.0);
+}
+
 // *** Range iteration ***
 
-TEST_CASE_TEMPLATE("Range iteration", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("Range iteration", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec {mock_0, mock_1, mock_2, mock_3};
   constexpr auto vec_size = 4;
 
@@ -412,7 +507,9 @@ TEST_CASE_TEMPLATE("Range iteration", T, layout::aos, layout::soa) {
   }
 }
 
-TEST_CASE_TEMPLATE("Range iteration reads velocity", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE(
+    "Range iteration reads velocity", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>
+) {
   container<T> vec {mock_0, mock_1, mock_2, mock_3};
   std::array<Mock const*, 4> const mocks {&mock_0, &mock_1, &mock_2, &mock_3};
 
@@ -423,7 +520,9 @@ TEST_CASE_TEMPLATE("Range iteration reads velocity", T, layout::aos, layout::soa
   }
 }
 
-TEST_CASE_TEMPLATE("Range iteration mutates elements", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE(
+    "Range iteration mutates elements", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>
+) {
   container<T> vec {mock_0, mock_1, mock_2, mock_3};
 
   for (auto elem: vec) {
@@ -437,7 +536,7 @@ TEST_CASE_TEMPLATE("Range iteration mutates elements", T, layout::aos, layout::s
 
 // *** Algorithm compatibility ***
 
-TEST_CASE_TEMPLATE("std::find_if compatibility", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("std::find_if compatibility", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec {mock_0, mock_1, mock_2, mock_3};
 
   auto it = std::find_if(vec.begin(), vec.end(), [](auto const& elem) { return elem.id() == 2; });
@@ -445,11 +544,33 @@ TEST_CASE_TEMPLATE("std::find_if compatibility", T, layout::aos, layout::soa) {
   CHECK((*it).id() == mock_2.id);
 }
 
-TEST_CASE_TEMPLATE("std::count_if compatibility", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("std::count_if compatibility", T, layout::aos, layout::soa, layout::packed_soa, layout::aosoa<2>) {
   container<T> vec {mock_0, mock_1, mock_2, mock_3};
 
   auto count = std::count_if(vec.begin(), vec.end(), [](auto const& elem) { return elem.density() > 13.0; });
   CHECK(count == 3);
 }
 
+TEST_CASE_TEMPLATE("std::ranges::sort compatibility", T, layout::aos, layout::soa, layout::packed_soa) {
+  container<T> vec {mock_2, mock_0, mock_3, mock_1};
+
+  SUBCASE("ascending") {
+    std::ranges::sort(vec, {}, [](Mock const& elem) { return elem.id; });
+
+    CHECK(vec == container<T> {mock_0, mock_1, mock_2, mock_3});
+  }
+
+  SUBCASE("descending") {
+    std::ranges::sort(vec, [](Mock const& a, Mock const& b) { return a.density > b.density; });
+
+    CHECK(vec == container<T> {mock_3, mock_2, mock_1, mock_0});
+  }
+
+  SUBCASE("iter_swap") {
+    std::ranges::iter_swap(vec.begin(), vec.begin() + 3);
+
+    CHECK(vec == container<T> {mock_1, mock_0, mock_3, mock_2});
+  }
+}
+
 TEST_SUITE_END();
@@ -0,0 +1,149 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file test_flat_multi_vector.cpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Tests for flat_multi_vector (SoA with flattened class type members)
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "test_containers.hpp"
+
+#include <vector>
+
+using namespace rflect;
+
+namespace {
+
+// Not an aggregate, like the math vectors of the fluid simulator
+struct Vec3 {
+  constexpr Vec3() = default;
+
+  constexpr Vec3(std::double_t const x, std::double_t const y, std::double_t const z) : x(x), y(y), z(z) { }
+
+  friend constexpr bool operator==(Vec3 const&, Vec3 const&) = default;
+
+  std::double_t x {};
+  std::double_t y {};
+  std::double_t z {};
+};
+
+struct Body {
+  DEFINE_PROXY(id, position, velocity);
+
+  std::int32_t id;
+  Vec3 position;
+  Vec3 velocity;
+};
+
+constexpr bool operator==(Body const& a, Body const& b) {
+  return a.id == b.id and a.position == b.position and a.velocity == b.velocity;
+}
+
+constexpr Body body_0 {.id = 0, .position = {1.0, 2.0, 3.0}, .velocity = {0.5, 0.0, 0.0}};
+constexpr Body body_1 {.id = 1, .position = {4.0, 5.0, 6.0}, .velocity = {0.0, 0.5, 0.0}};
+constexpr Body body_2 {.id = 2, .position = {7.0, 8.0, 9.0}, .velocity = {0.0, 0.0, 0.5}};
+
+constexpr auto id_field       = std::define_static_string("id");
+constexpr auto position_field = std::define_static_string("position");
+
+} // namespace
+
+using flat_vector = flat_multi_vector<Body>;
+
+TEST_SUITE_BEGIN("Flat Multi Vector");
+
+// *** Conversions ***
+
+TEST_CASE("flatten and unflatten") {
+  auto const flat = flatten(body_1);
+  CHECK(flat.id == body_1.id);
+  CHECK(flat.position_y == body_1.position.y);
+  CHECK(flat.velocity_y == body_1.velocity.y);
+  CHECK(unflatten<Body>(flat) == body_1);
+}
+
+// *** Element access ***
+
+TEST_CASE("Every coordinate gets its own column") {
+  flat_vector vec {body_0, body_1, body_2};
+  CHECK(vec.size() == 3U);
+
+  auto const spans = vec.spans();
+  CHECK(spans.position_x[1] == body_1.position.x);
+  CHECK(spans.position_z[2] == body_2.position.z);
+  CHECK(spans.velocity_y[1] == body_1.velocity.y);
+  CHECK(vec.items<1>().data() == spans.position_x.data());
+  CHECK(std::get<3>(vec.at(2)) == body_2.position.z);
+}
+
+TEST_CASE("items by member name") {
+  flat_vector vec {body_0, body_1};
+
+  CHECK(vec.items<id_field>()[1] == body_1.id);
+
+  auto positions = vec.items<position_field>();
+  CHECK(positions.size() == 2U);
+  CHECK(Vec3(positions[1]) == body_1.position);
+
+  positions[0].y = 42.0;
+  CHECK(vec.spans().position_y[0] == 42.0);
+
+  positions[0] = body_2.position;
+  CHECK(vec.spans().position_x[0] == body_2.position.x);
+  CHECK(vec.spans().position_z[0] == body_2.position.z);
+}
+
+// *** Modifiers ***
+
+TEST_CASE("append_range, insert and erase") {
+  std::vector const bodies {body_1, body_2};
+
+  flat_vector vec {body_0};
+  vec.append_range(bodies);
+  CHECK(vec == flat_vector {body_0, body_1, body_2});
+
+  vec.erase(vec.begin());
+  CHECK(vec == flat_vector {body_1, body_2});
+
+  vec.insert(vec.begin() + 1, bodies.begin(), bodies.begin() + 1);
+  CHECK(vec == flat_vector {body_1, body_1, body_2});
+
+  vec.resize(1);
+  vec.push_back(vec.at(0));
+  CHECK(vec == flat_vector {body_1, body_1});
+}
+
+// *** Proxies ***
+
+TEST_CASE("dual_vector with flat layout") {
+  dual_vector<Body, layout::soa_flat> bodies {body_0, body_1};
+
+  bodies[0].position().x += 1.0;
+  CHECK(bodies.spans().position_x[0] == body_0.position.x + 1.0);
+
+  Vec3 const position = bodies[1].position();
+  CHECK(position == body_1.position);
+
+  bodies[0].velocity() = bodies[1].velocity();
+  CHECK(Vec3(bodies[0].velocity()) == body_1.velocity);
+
+  bodies[1] = body_2;
+  CHECK(bodies.spans().id[1] == body_2.id);
+  CHECK(Vec3(bodies[1].position()) == body_2.position);
+
+  bodies.push_back(bodies[1]);
+  CHECK(bodies.size() == 3U);
+  CHECK(bodies.spans().position_y[2] == body_2.position.y);
+
+  auto const& const_bodies = bodies;
+  static_assert(std::same_as<decltype(const_bodies[0].position()), member_reference<Vec3 const>>);
+  CHECK(Vec3(const_bodies[2].position()) == body_2.position);
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,109 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file test_for_each.cpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Tests for the chunked (parallel) for_each
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "test_containers.hpp"
+
+#include <rflect/introspection/for_each.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+
+using namespace rflect;
+
+template<typename Layout>
+using container = dual_vector<Mock, Layout>;
+
+TEST_SUITE_BEGIN("For each");
+
+TEST_CASE("Chunk granularity covers a cache line of every column") {
+  // id (4 bytes) needs 16 elements per line, density (8 bytes) 8, velocity (24 bytes) 8
+  CHECK(detail::chunk_granularity<container<layout::soa>>() == 16U);
+  CHECK(detail::chunk_granularity<multi_vector<Mock>>() == 16U);
+  CHECK(detail::chunk_granularity<container<layout::aos>>() == 8U);
+}
+
+TEST_CASE_TEMPLATE("Sequential for_each visits elements in order", T, layout::aos, layout::soa, layout::packed_soa) {
+  auto mocks = make_mocks<container<T>>(100);
+
+  std::int32_t expected = 0;
+  for_each(execution::seq, mocks, [&expected](auto mock) { CHECK(mock.id() == expected++); });
+  CHECK(expected == 100);
+}
+
+TEST_CASE_TEMPLATE("Parallel for_each visits every element once", T, layout::aos, layout::soa, layout::packed_soa) {
+  auto mocks = make_mocks<container<T>>(1000);
+
+  for_each(execution::parallel_policy {.threads = 4}, mocks, [](auto mock) { mock.density() += mock.id(); });
+
+  for (std::int32_t i = 0; auto mock: mocks) {
+    auto const id = static_cast<std::double_t>(i++);
+    CHECK(mock.density() == id / 2 + id);
+  }
+}
+
+TEST_CASE("Parallel chunks start at cache line boundaries") {
+  auto mocks = make_mocks<container<layout::soa>>(1000);
+  std::mutex mutex;
+  std::vector<std::size_t> starts;
+  std::atomic<std::size_t> visited = 0;
+
+  for_each_chunk(execution::parallel_policy {.threads = 3}, mocks, [&](auto chunk) {
+    visited += std::ranges::size(chunk);
+    std::scoped_lock lock(mutex);
+    starts.push_back(chunk.begin().index());
+  });
+
+  CHECK(visited == 1000U);
+  CHECK(starts.size() == 3U);
+  for (auto const start: starts) {
+    CHECK(start % 16 == 0U);
+  }
+}
+
+TEST_CASE("Parallel for_each over multi_vector") {
+  multi_vector<Mock> mocks;
+  for (std::int32_t i = 0; i < 500; ++i) {
+    mocks.push_back(Mock {.id = i, .density = 1.0, .velocity = {}});
+  }
+
+  for_each(execution::par, mocks, [](auto mock) {
+    auto& [id, density, velocity] = mock;
+    density *= id;
+  });
+
+  CHECK(mocks.items<1>()[0] == 0.0);
+  CHECK(mocks.items<1>()[499] == 499.0);
+}
+
+TEST_CASE("The worker pool is reused across calls and runs nested jobs inline") {
+  auto& pool = detail::shared_pool();
+  std::mutex mutex;
+  std::set<std::thread::id> threads;
+  std::atomic<std::size_t> nested = 0;
+
+  for (int call = 0; call < 10; ++call) {
+    pool.run(8, [&](std::size_t) {
+      pool.run(2, [&nested](std::size_t) { ++nested; });
+      std::scoped_lock lock(mutex);
+      threads.insert(std::this_thread::get_id());
+    });
+  }
+
+  CHECK(nested == 160U);
+  CHECK(threads.size() <= pool.size());
+}
+
+TEST_SUITE_END();
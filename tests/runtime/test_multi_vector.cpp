@@ -38,6 +38,59 @@ TEST_CASE("Explicit size constructor") {
   CHECK(vec.empty() == false);
 }
 
+TEST_CASE("Allocator constructor") {
+  counting_resource resource;
+  pmr::multi_vector<Mock> vec(&resource);
+  CHECK(vec.get_allocator().resource() == &resource);
+
+  vec.push_back(mock_0);
+  CHECK(resource.allocations == 3U); // One per column
+
+  pmr::multi_vector<Mock> sized(2, &resource);
+  CHECK(sized.size() == 2U);
+  CHECK(resource.allocations == 6U);
+
+  pmr::multi_vector<Mock> listed({mock_0, mock_1}, &resource);
+  CHECK(listed.size() == 2U);
+  CHECK(listed.items<0>()[1] == mock_1.id);
+  CHECK(resource.allocations == 9U);
+}
+
+TEST_CASE("Allocator constructor with a monotonic arena") {
+  std::array<std::byte, 4096> buffer {};
+  std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+  pmr::multi_vector<Mock> vec(&arena);
+  vec.reserve(8);
+  vec.push_back(mock_0);
+
+  auto const* const column = reinterpret_cast<std::byte const*>(vec.items<1>().data());
+  CHECK(column >= buffer.data());
+  CHECK(column < buffer.data() + buffer.size());
+}
+
+TEST_CASE("Aligned columns") {
+  multi_vector<Mock, std::allocator, 64> vec {mock_0, mock_1, mock_2};
+  for (std::size_t i = 0; i < 100; ++i) {
+    vec.push_back(mock_3);
+  }
+
+  auto const aligned = [](auto const* const data) { return reinterpret_cast<std::uintptr_t>(data) % 64 == 0; };
+  CHECK(aligned(vec.items<0>().data()));
+  CHECK(aligned(vec.items<1>().data()));
+  CHECK(aligned(vec.items<2>().data()));
+  CHECK(vec.size() == 103U);
+  CHECK(vec.items<1>()[1] == mock_1.density);
+
+  // 103 doubles span 824 bytes, padded up to 832
+  CHECK(vec.padded_items<1>().data() == vec.items<1>().data());
+  CHECK(vec.padded_items<1>().size() == 104U);
+  CHECK(vec.padded_items<0>().size_bytes() % 64 == 0);
+
+  pmr::multi_vector<Mock, 128> arena_vec(3, std::pmr::new_delete_resource());
+  CHECK(reinterpret_cast<std::uintptr_t>(arena_vec.items<2>().data()) % 128 == 0);
+  CHECK(arena_vec.get_allocator().resource() == std::pmr::new_delete_resource());
+}
+
 // *** Capacity ***
 
 TEST_CASE("size after construction") {
@@ -472,4 +525,79 @@ TEST_CASE("pop_back visible in items<N>") {
   CHECK(vec.items<0>().back() == mock_1.id);
 }
 
+// *** Element access ***
+
+TEST_CASE("at is bound to its own instance") {
+  multi_vector<Mock> vec_a {mock_0, mock_1};
+  multi_vector<Mock> vec_b {mock_2, mock_3};
+
+  CHECK(std::get<0>(vec_a.at(0)) == mock_0.id);
+  CHECK(std::get<0>(vec_b.at(0)) == mock_2.id);
+  CHECK(std::get<1>(vec_b.at(1)) == mock_3.density);
+}
+
+TEST_CASE("at observes reallocated columns") {
+  multi_vector<Mock> vec {mock_0};
+  CHECK(std::get<0>(vec.at(0)) == mock_0.id);
+
+  for (auto const& mock: {mock_1, mock_2, mock_3, mock_0, mock_1, mock_2, mock_3}) {
+    vec.push_back(mock);
+  }
+  std::get<0>(vec.at(7)) = 42;
+
+  CHECK(std::get<0>(vec.at(3)) == mock_3.id);
+  CHECK(vec.items<0>()[7] == 42);
+  CHECK(std::get<0>(vec.back()) == 42);
+}
+
+TEST_CASE("spans view every column") {
+  multi_vector<Mock> vec {mock_0, mock_1, mock_2};
+  auto spans = vec.spans();
+
+  CHECK(spans.id.size() == 3U);
+  CHECK(spans.id.data() == vec.items<0>().data());
+  spans.density[1] = -1.0;
+  CHECK(vec.items<1>()[1] == -1.0);
+
+  auto const& const_vec = vec;
+  CHECK((std::same_as<decltype(const_vec.spans().velocity), std::span<std::array<std::double_t, 3> const>>));
+}
+
+// *** Bulk modifiers ***
+
+TEST_CASE("append_range writes every column") {
+  multi_vector<Mock> vec {mock_0};
+  std::vector<Mock> const mocks {mock_1, mock_2, mock_3};
+
+  vec.append_range(mocks);
+
+  CHECK(vec.size() == 4U);
+  CHECK(vec.items<0>() == std::vector<std::int32_t> {0, 1, 2, 3});
+  CHECK(vec.items<1>()[3] == mock_3.density);
+  CHECK(vec.items<2>()[1] == mock_1.velocity);
+}
+
+TEST_CASE("insert range before position") {
+  multi_vector<Mock> vec {mock_0, mock_3};
+  std::vector<Mock> const mocks {mock_1, mock_2};
+
+  auto it = vec.insert(vec.begin() + 1, mocks.begin(), mocks.end());
+
+  CHECK(std::get<0>(*it) == mock_1.id);
+  CHECK(vec.items<0>() == std::vector<std::int32_t> {0, 1, 2, 3});
+}
+
+TEST_CASE("reserve and resize apply to every column") {
+  multi_vector<Mock> vec {mock_0, mock_1};
+
+  vec.reserve(32);
+  CHECK(vec.items<0>().capacity() >= 32U);
+  CHECK(vec.items<2>().capacity() >= 32U);
+
+  vec.resize(5);
+  CHECK(vec.size() == 5U);
+  CHECK(vec.items<1>().size() == 5U);
+  CHECK(vec.items<0>()[4] == 0);
+}
+
 TEST_SUITE_END();
@@ -0,0 +1,221 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file test_packed_multi_vector.cpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Tests for packed_multi_vector (single allocation SoA storage)
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "test_containers.hpp"
+
+#include <array>
+#include <stdexcept>
+
+using namespace rflect;
+
+constexpr auto id_field = std::define_static_string("id");
+
+template<typename Column>
+std::uintptr_t address_of(Column const& column) {
+  return reinterpret_cast<std::uintptr_t>(column.data()); // NOLINT
+}
+
+/**
+ * Counts live instances. The copy constructor throws when `copies_left` reaches 0, negative values never throw
+ */
+struct counted {
+  static inline int live        = 0;
+  static inline int copies_left = -1;
+
+  counted() { ++live; }
+
+  counted(counted const& /*other*/) {
+    if (copies_left == 0) {
+      throw std::runtime_error("copy");
+    }
+    --copies_left;
+    ++live;
+  }
+
+  counted& operator=(counted const&) = default;
+
+  ~counted() { --live; }
+};
+
+struct Pair {
+  counted first;
+  counted second;
+};
+
+TEST_SUITE_BEGIN("Packed Multi Vector");
+
+// *** Constructors ***
+
+TEST_CASE("Default constructor") {
+  packed_multi_vector<Mock> vec;
+  CHECK(vec.size() == 0U);
+  CHECK(vec.capacity() == 0U);
+  CHECK(vec.empty() == true);
+}
+
+TEST_CASE("Initializer list constructor") {
+  packed_multi_vector<Mock> vec {mock_0, mock_1, mock_2};
+  CHECK(vec.size() == 3U);
+  CHECK(vec.capacity() == 3U);
+  CHECK(std::get<0>(vec.at(0)) == mock_0.id);
+  CHECK(std::get<1>(vec.at(2)) == mock_2.density);
+}
+
+TEST_CASE("Explicit size constructor") {
+  packed_multi_vector<Mock> vec(4);
+  CHECK(vec.size() == 4U);
+  CHECK(vec.items<0>()[3] == 0);
+}
+
+TEST_CASE("Copy and move") {
+  packed_multi_vector<Mock> vec {mock_0, mock_1};
+
+  packed_multi_vector<Mock> copy = vec;
+  CHECK(copy == vec);
+  CHECK(copy.items<0>().data() != vec.items<0>().data());
+
+  packed_multi_vector<Mock> moved = std::move(copy);
+  CHECK(moved == vec);
+  CHECK(copy.size() == 0U);
+
+  copy = moved;
+  CHECK(copy == vec);
+}
+
+// *** Storage ***
+
+TEST_CASE("Columns share a single cache line aligned buffer") {
+  packed_multi_vector<Mock> vec {mock_0, mock_1, mock_2};
+
+  auto const ids        = address_of(vec.items<0>());
+  auto const densities  = address_of(vec.items<1>());
+  auto const velocities = address_of(vec.items<2>());
+
+  CHECK(ids % packed_multi_vector<Mock>::column_alignment == 0U);
+  CHECK(densities % packed_multi_vector<Mock>::column_alignment == 0U);
+  CHECK(velocities % packed_multi_vector<Mock>::column_alignment == 0U);
+  CHECK(ids < densities);
+  CHECK(densities < velocities);
+}
+
+TEST_CASE("reserve relocates every column at once") {
+  packed_multi_vector<Mock> vec {mock_0, mock_1};
+
+  vec.reserve(100);
+  CHECK(vec.capacity() == 100U);
+  CHECK(vec.size() == 2U);
+  CHECK(vec.items<0>()[0] == mock_0.id);
+  CHECK(vec.items<2>()[1] == mock_1.velocity);
+  CHECK(address_of(vec.items<1>()) - address_of(vec.items<0>()) >= 100U * sizeof(Mock::id));
+}
+
+TEST_CASE("items returns spans over the live elements") {
+  packed_multi_vector<Mock> vec {mock_0, mock_1, mock_2};
+
+  auto ids = vec.items<id_field>();
+  CHECK(ids.size() == 3U);
+  ids[1] = 42;
+  CHECK(std::get<0>(vec.at(1)) == 42);
+  CHECK(vec.spans().density[2] == mock_2.density);
+}
+
+// *** Modifiers ***
+
+TEST_CASE("push_back grows geometrically") {
+  packed_multi_vector<Mock> vec;
+  for (auto const& mock: {mock_0, mock_1, mock_2, mock_3}) {
+    vec.push_back(mock);
+  }
+
+  CHECK(vec.size() == 4U);
+  CHECK(vec.capacity() == 4U);
+  CHECK(std::get<0>(vec.back()) == mock_3.id);
+}
+
+TEST_CASE("push_back tuple") {
+  packed_multi_vector<Mock> vec {mock_0};
+  packed_multi_vector<Mock> const other {mock_1};
+  vec.push_back(*other.begin());
+  CHECK(vec == packed_multi_vector<Mock> {mock_0, mock_1});
+}
+
+TEST_CASE("pop_back and clear") {
+  packed_multi_vector<Mock> vec {mock_0, mock_1, mock_2};
+
+  vec.pop_back();
+  CHECK(vec.size() == 2U);
+  CHECK(std::get<0>(vec.back()) == mock_1.id);
+
+  vec.clear();
+  CHECK(vec.empty() == true);
+  CHECK(vec.capacity() == 3U);
+}
+
+TEST_CASE("erase") {
+  packed_multi_vector<Mock> vec {mock_0, mock_1, mock_2, mock_3};
+
+  vec.erase(vec.begin() + 1);
+  CHECK(vec == packed_multi_vector<Mock> {mock_0, mock_2, mock_3});
+
+  vec.erase(vec.begin(), vec.begin() + 2);
+  CHECK(vec == packed_multi_vector<Mock> {mock_3});
+}
+
+TEST_CASE("push_back destroys the columns built before a throwing member") {
+  packed_multi_vector<Pair> vec;
+  vec.reserve(4);
+  Pair const item {};
+  vec.push_back(item);
+  auto const live = counted::live;
+
+  counted::copies_left = 1;
+  CHECK_THROWS_AS(vec.push_back(item), std::runtime_error);
+  counted::copies_left = -1;
+
+  CHECK(vec.size() == 1U);
+  CHECK(counted::live == live);
+}
+
+TEST_CASE("append_range destroys the columns built before a throwing member") {
+  packed_multi_vector<Pair> vec;
+  vec.reserve(4);
+  std::array<Pair, 3> const items {};
+  auto const live = counted::live;
+
+  counted::copies_left = 4;
+  CHECK_THROWS_AS(vec.append_range(items), std::runtime_error);
+  counted::copies_left = -1;
+
+  CHECK(vec.empty());
+  CHECK(counted::live == live);
+}
+
+TEST_CASE("Assignment keeps allocators that do not propagate on swap") {
+  counting_resource first;
+  counting_resource second;
+  packed_multi_vector<Mock, std::pmr::polymorphic_allocator> vec(std::pmr::polymorphic_allocator<Mock>(&first));
+  packed_multi_vector<Mock, std::pmr::polymorphic_allocator> other(std::pmr::polymorphic_allocator<Mock>(&second));
+  other.push_back(mock_0);
+  other.push_back(mock_1);
+
+  vec = other;
+  CHECK(vec == other);
+  CHECK(first.allocations == 1U);
+
+  vec = std::move(other);
+  CHECK(vec.size() == 2U);
+  CHECK(first.allocations == 1U);
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,125 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file test_permute.cpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Tests for permute, gather and scatter (same indices over every member column)
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "test_containers.hpp"
+
+#include <rflect/introspection/permute.hpp>
+
+#include <vector>
+
+using namespace rflect;
+
+constexpr Mock mock_4 {.id = 4, .density = 16.15, .velocity = {}};
+constexpr Mock mock_5 {.id = 5, .density = 17.15, .velocity = {}};
+
+TEST_SUITE_BEGIN("Permute");
+
+TEST_CASE_TEMPLATE(
+    "permute reorders every member", Container, multi_vector<Mock>, packed_multi_vector<Mock>,
+    dual_vector<Mock, layout::soa>, dual_vector<Mock, layout::aos>, std::vector<Mock>
+) {
+  Container mocks {mock_0, mock_1, mock_2, mock_3};
+  std::vector<std::size_t> const indices {2, 0, 3, 1};
+
+  permute(mocks, indices);
+  CHECK(mocks == Container {mock_2, mock_0, mock_3, mock_1});
+}
+
+TEST_CASE("permute on arrays and gather layouts") {
+  multi_array<Mock, 3> arr {mock_0, mock_1, mock_2};
+  permute(arr, std::vector {2U, 1U, 0U});
+  CHECK(arr == multi_array<Mock, 3> {mock_2, mock_1, mock_0});
+
+  dual_vector<Mock, layout::split<&Mock::density>> split {mock_0, mock_1, mock_2};
+  permute(split, std::vector {1, 2, 0});
+  CHECK(split[0] == mock_1);
+  CHECK(split[1] == mock_2);
+  CHECK(split[2] == mock_0);
+}
+
+TEST_CASE_TEMPLATE(
+    "In place permutation follows cycles", Container, multi_vector<Mock>, dual_vector<Mock, layout::soa>,
+    std::vector<Mock>
+) {
+  // Cycles (0 3 1) and (2 4), plus a fixed point
+  Container mocks {mock_0, mock_1, mock_2, mock_3, mock_4, mock_5};
+  std::vector<std::size_t> const indices {3, 0, 4, 1, 2, 5};
+
+  Container expected = mocks;
+  permute(expected, indices);
+  permute(permutation::in_place, mocks, indices);
+  CHECK(mocks == expected);
+}
+
+TEST_CASE("gather selects elements into another container") {
+  multi_vector<Mock> const mocks {mock_0, mock_1, mock_2, mock_3};
+
+  packed_multi_vector<Mock> packed;
+  gather(mocks, std::vector {3, 3, 1}, packed);
+  CHECK(packed == packed_multi_vector<Mock> {mock_3, mock_3, mock_1});
+
+  std::vector<Mock> plain;
+  gather(std::vector {mock_0, mock_1}, std::vector {1}, plain);
+  CHECK(plain == std::vector {mock_1});
+
+  dual_vector<Mock, layout::aos> const aos {mock_0, mock_1, mock_2};
+  dual_vector<Mock, layout::aos> reversed;
+  gather(aos, std::vector {2, 1, 0}, reversed);
+  CHECK(reversed == dual_vector<Mock, layout::aos> {mock_2, mock_1, mock_0});
+}
+
+TEST_CASE("scatter is the inverse of gather") {
+  dual_vector<Mock, layout::soa> const mocks {mock_0, mock_1, mock_2, mock_3};
+  std::vector<std::size_t> const indices {2, 0, 3, 1};
+
+  dual_vector<Mock, layout::soa> gathered;
+  gather(mocks, indices, gathered);
+  dual_vector<Mock, layout::soa> scattered;
+  scatter(gathered, indices, scattered);
+  CHECK(scattered == mocks);
+
+  multi_array<Mock, 4> arr {};
+  scatter(multi_vector<Mock> {mock_0, mock_1, mock_2, mock_3}, std::vector {3, 2, 1, 0}, arr);
+  CHECK(arr == multi_array<Mock, 4> {mock_3, mock_2, mock_1, mock_0});
+}
+
+TEST_CASE("gather and scatter between columnar and element containers") {
+  multi_vector<Mock> const columns {mock_0, mock_1, mock_2};
+  dual_vector<Mock, layout::soa> const soa {mock_0, mock_1, mock_2};
+  std::vector<std::size_t> const indices {2, 0, 1};
+
+  std::vector<Mock> plain;
+  gather(columns, indices, plain);
+  CHECK(plain == std::vector {mock_2, mock_0, mock_1});
+
+  dual_vector<Mock, layout::aos> aos;
+  gather(soa, indices, aos);
+  CHECK(aos == dual_vector<Mock, layout::aos> {mock_2, mock_0, mock_1});
+
+  multi_vector<Mock> scattered;
+  scatter(plain, indices, scattered);
+  CHECK(scattered == columns);
+}
+
+TEST_CASE("Identity and empty permutations") {
+  multi_vector<Mock> mocks {mock_0, mock_1};
+  permute(mocks, std::vector {0, 1});
+  CHECK(mocks == multi_vector<Mock> {mock_0, mock_1});
+
+  multi_vector<Mock> empty;
+  permute(empty, std::vector<std::size_t> {});
+  CHECK(empty.empty() == true);
+}
+
+TEST_SUITE_END();
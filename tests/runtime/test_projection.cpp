@@ -0,0 +1,100 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file test_projection.cpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Tests for projection_view (member subset views over SoA containers)
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "test_containers.hpp"
+
+#include <algorithm>
+
+using namespace rflect;
+
+constexpr auto id_field      = std::define_static_string("id");
+constexpr auto density_field = std::define_static_string("density");
+
+TEST_SUITE_BEGIN("Projection");
+
+// *** Element access ***
+
+TEST_CASE_TEMPLATE("Only the selected columns are viewed", Container, dual_vector<Mock, layout::soa>,
+                   multi_vector<Mock>) {
+  Container mocks {mock_0, mock_1, mock_2};
+  auto const view = project<&Mock::density, &Mock::id>(mocks);
+
+  static_assert(std::ranges::view<decltype(view)>);
+  static_assert(std::ranges::random_access_range<decltype(view)>);
+  static_assert(sizeof(view) == 2 * sizeof(std::span<std::double_t>));
+
+  CHECK(view.size() == 3U);
+  CHECK(view.items<id_field>().data() == mocks.template items<id_field>().data());
+  CHECK(view.items<density_field>()[2] == mock_2.density);
+
+  // Declaration order, not template argument order
+  CHECK(std::get<0>(view.at(1)) == mock_1.id);
+  CHECK(std::get<1>(view.at(1)) == mock_1.density);
+  CHECK(view.spans().density.size() == 3U);
+}
+
+TEST_CASE("Proxies write through to the container") {
+  dual_vector<Mock, layout::soa> mocks {mock_0, mock_1, mock_2};
+  auto const view = project<&Mock::density>(mocks);
+
+  for (auto mock: view) {
+    mock.density() += 1.0;
+  }
+  CHECK(mocks[0].density() == mock_0.density + 1.0);
+  CHECK(mocks[2].density() == mock_2.density + 1.0);
+
+  view[1].density() = 0.0;
+  CHECK(mocks[1].density() == 0.0);
+  CHECK(mocks[1].id() == mock_1.id);
+}
+
+TEST_CASE("Elements are the selected members only") {
+  dual_vector<Mock, layout::soa> mocks {mock_0, mock_1, mock_2};
+  auto const view = project<&Mock::density>(mocks);
+
+  using members_type = struct_with<Mock, &Mock::density>;
+  static_assert(std::same_as<std::ranges::range_value_t<decltype(view)>, members_type>);
+  static_assert(std::same_as<std::ranges::range_rvalue_reference_t<decltype(view)>, members_type>);
+  static_assert(std::permutable<std::ranges::iterator_t<decltype(view)>>);
+
+  members_type const density = view[1];
+  CHECK(density.density == mock_1.density);
+
+  std::ranges::reverse(view);
+  CHECK(mocks[0].density() == mock_2.density);
+  CHECK(mocks[2].density() == mock_0.density);
+  CHECK(mocks[0].id() == mock_0.id);
+  CHECK(mocks[2].id() == mock_2.id);
+  CHECK(mocks[0].velocity() == mock_0.velocity);
+}
+
+TEST_CASE("to_zip zips the selected columns only") {
+  dual_vector<Mock, layout::soa> mocks {mock_0, mock_1, mock_2};
+  auto const view = project<&Mock::id, &Mock::density>(mocks);
+
+  static_assert(std::tuple_size_v<std::ranges::range_value_t<decltype(view.to_zip())>> == 2);
+
+  auto const it = std::ranges::find_if(view.to_zip(), [](auto const& mock) { return std::get<0>(mock) == 2; });
+  CHECK(std::get<1>(*it) == mock_2.density);
+}
+
+TEST_CASE("Const containers give read only views") {
+  dual_vector<Mock, layout::soa> const mocks {mock_0, mock_1};
+  auto const view = project<&Mock::id>(mocks);
+
+  static_assert(std::same_as<decltype(view.items<id_field>()), std::span<std::int32_t const>>);
+  CHECK(view[1].id() == mock_1.id);
+}
+
+TEST_SUITE_END();
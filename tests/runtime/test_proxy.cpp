@@ -21,7 +21,7 @@ using namespace rflect;
 
 TEST_SUITE_BEGIN("Proxy");
 
-TEST_CASE_TEMPLATE("Modifying", T, layout::aos, layout::soa) {
+TEST_CASE_TEMPLATE("Modifying", T, layout::aos, layout::soa, layout::aosoa<2>) {
   dual_vector<Mock, T> mock {mock_0, mock_1};
 
   auto mock_view = mock.at(0);
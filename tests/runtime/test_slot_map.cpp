@@ -0,0 +1,184 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file test_slot_map.cpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Tests for slot_map (stable keys over dense SoA storage)
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "test_containers.hpp"
+
+#include <limits>
+#include <new>
+#include <stdexcept>
+
+using namespace rflect;
+
+using soa_map = slot_map<Mock, layout::soa>;
+using aos_map = slot_map<Mock, layout::aos>;
+
+constexpr auto id_field = std::define_static_string("id");
+
+/**
+ * Memory resource that throws `std::bad_alloc` once `remaining` allocations have been served
+ */
+class budget_resource : public std::pmr::memory_resource {
+public:
+  std::size_t remaining = std::numeric_limits<std::size_t>::max();
+
+private:
+  void* do_allocate(std::size_t const bytes, std::size_t const alignment) override {
+    if (remaining == 0) {
+      throw std::bad_alloc();
+    }
+    --remaining;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* const pointer, std::size_t const bytes, std::size_t const alignment) override {
+    std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+  }
+
+  [[nodiscard]] bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override {
+    return this == &other;
+  }
+};
+
+TEST_SUITE_BEGIN("Slot Map");
+
+// *** Lookup ***
+
+TEST_CASE_TEMPLATE("insert and lookup", Map, soa_map, aos_map) {
+  Map map;
+  CHECK(map.empty() == true);
+
+  auto const key_0 = map.insert(mock_0);
+  auto const key_1 = map.insert(mock_1);
+  CHECK(map.size() == 2U);
+  CHECK(map.contains(key_0) == true);
+  CHECK(map[key_0] == mock_0);
+  CHECK(map.at(key_1) == mock_1);
+  CHECK(map.index_of(key_1) == 1U);
+  CHECK(map.key_of(1) == key_1);
+  CHECK(*map.find(key_1) == mock_1);
+
+  map[key_0].density() = 1.0;
+  CHECK(map[key_0].density() == 1.0);
+}
+
+TEST_CASE_TEMPLATE("Invalid keys", Map, soa_map, aos_map) {
+  Map map;
+  auto const key = map.insert(mock_0);
+  CHECK(map.contains(slot_key {.index = 7, .generation = 0}) == false);
+  auto const stale = slot_key {.index = key.index, .generation = static_cast<std::uint32_t>(key.generation + 1)};
+  CHECK(map.contains(stale) == false);
+  CHECK_THROWS_AS(map.at(slot_key {.index = 7, .generation = 0}), std::out_of_range);
+  CHECK(map.find(slot_key {.index = 7, .generation = 0}) == map.end());
+}
+
+// *** Modifiers ***
+
+TEST_CASE_TEMPLATE("erase keeps the other keys valid", Map, soa_map, aos_map) {
+  Map map;
+  auto const key_0 = map.insert(mock_0);
+  auto const key_1 = map.insert(mock_1);
+  auto const key_2 = map.insert(mock_2);
+
+  CHECK(map.erase(key_0) == true);
+  CHECK(map.erase(key_0) == false);
+  CHECK(map.size() == 2U);
+  CHECK(map.contains(key_0) == false);
+
+  // The last element fills the hole
+  CHECK(map.index_of(key_2) == 0U);
+  CHECK(map[key_2] == mock_2);
+  CHECK(map[key_1] == mock_1);
+  CHECK(map.key_of(0) == key_2);
+}
+
+TEST_CASE_TEMPLATE("Slots are reused with a new generation", Map, soa_map, aos_map) {
+  Map map;
+  auto const key_0 = map.insert(mock_0);
+  map.insert(mock_1);
+  map.erase(key_0);
+
+  auto const key_3 = map.insert(mock_3);
+  CHECK(key_3.index == key_0.index);
+  CHECK(key_3.generation != key_0.generation);
+  CHECK(map.contains(key_0) == false);
+  CHECK(map[key_3] == mock_3);
+}
+
+TEST_CASE_TEMPLATE("clear invalidates every key", Map, soa_map, aos_map) {
+  Map map;
+  auto const key_0 = map.insert(mock_0);
+  auto const key_1 = map.insert(mock_1);
+
+  map.clear();
+  CHECK(map.empty() == true);
+  CHECK(map.contains(key_0) == false);
+  CHECK(map.contains(key_1) == false);
+
+  auto const key_2 = map.insert(mock_2);
+  CHECK(map.contains(key_2) == true);
+  CHECK(map[key_2] == mock_2);
+}
+
+// *** Dense storage ***
+
+TEST_CASE("Columns stay packed after erasure") {
+  soa_map map;
+  auto const key_0 = map.insert(mock_0);
+  map.insert(mock_1);
+  map.insert(mock_2);
+  map.erase(key_0);
+
+  auto const ids = map.items<id_field>();
+  CHECK(ids.size() == 2U);
+  CHECK(ids[0] == mock_2.id);
+  CHECK(ids[1] == mock_1.id);
+  CHECK(map.spans().density[0] == mock_2.density);
+  CHECK(map.keys().size() == 2U);
+
+  std::size_t count = 0;
+  for (auto const mock: map) {
+    CHECK(mock.id() == ids[count++]);
+  }
+  CHECK(count == 2U);
+}
+
+TEST_CASE("Allocator constructor") {
+  counting_resource resource;
+  slot_map<Mock, layout::soa, std::pmr::polymorphic_allocator> map(&resource);
+
+  map.insert(mock_0);
+  CHECK(resource.allocations == 5U); // One per column, the key table and the slot table
+}
+
+TEST_CASE("insert leaves the map unchanged when an allocation throws") {
+  budget_resource resource;
+  slot_map<Mock, layout::soa, std::pmr::polymorphic_allocator> map(&resource);
+  auto const key_0 = map.insert(mock_0);
+
+  // Both tables grow, so does the id column, and the density column throws
+  resource.remaining = 3;
+  CHECK_THROWS_AS(map.insert(mock_1), std::bad_alloc);
+  CHECK(map.size() == 1U);
+  CHECK(map.keys().size() == 1U);
+  CHECK(map.items<id_field>().size() == 1U);
+  CHECK(map[key_0] == mock_0);
+
+  resource.remaining = std::numeric_limits<std::size_t>::max();
+  auto const key_1 = map.insert(mock_1);
+  CHECK(key_1.index == 1U);
+  CHECK(map.index_of(key_1) == 1U);
+  CHECK(map[key_1] == mock_1);
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,193 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file test_small_multi_vector.cpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Tests for small_multi_vector (inline SoA storage spilling to the heap)
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "test_containers.hpp"
+
+#include <vector>
+
+using namespace rflect;
+
+using small_vector = small_multi_vector<Mock, 3>;
+
+constexpr auto id_field = std::define_static_string("id");
+
+TEST_SUITE_BEGIN("Small Multi Vector");
+
+// *** Constructors ***
+
+TEST_CASE("Default constructor") {
+  small_vector vec;
+  CHECK(vec.size() == 0U);
+  CHECK(vec.capacity() == small_vector::inline_capacity);
+  CHECK(vec.is_inline() == true);
+}
+
+TEST_CASE("Initializer list constructor") {
+  small_vector vec {mock_0, mock_1, mock_2};
+  CHECK(vec.size() == 3U);
+  CHECK(vec.is_inline() == true);
+  CHECK(std::get<0>(vec.at(0)) == mock_0.id);
+  CHECK(std::get<1>(vec.at(2)) == mock_2.density);
+
+  small_vector spilled {mock_0, mock_1, mock_2, mock_3};
+  CHECK(spilled.size() == 4U);
+  CHECK(spilled.is_inline() == false);
+  CHECK(std::get<0>(spilled.back()) == mock_3.id);
+}
+
+TEST_CASE("Explicit size constructor") {
+  small_vector vec(2);
+  CHECK(vec.size() == 2U);
+  CHECK(vec.is_inline() == true);
+  CHECK(vec.items<0>()[1] == 0);
+}
+
+TEST_CASE("Allocator constructor") {
+  counting_resource resource;
+  small_multi_vector<Mock, 3, std::pmr::polymorphic_allocator> vec(&resource);
+
+  vec.append_range(std::vector {mock_0, mock_1, mock_2});
+  CHECK(resource.allocations == 0U);
+
+  vec.push_back(mock_3);
+  CHECK(resource.allocations == 3U); // One per heap column
+}
+
+TEST_CASE("Copy and move") {
+  for (small_vector const vec: {small_vector {mock_0, mock_1}, small_vector {mock_0, mock_1, mock_2, mock_3}}) {
+    small_vector copy = vec;
+    CHECK(copy == vec);
+    CHECK(copy.items<0>().data() != vec.items<0>().data());
+
+    small_vector moved = std::move(copy);
+    CHECK(moved == vec);
+    CHECK(copy.empty() == true);
+    CHECK(copy.is_inline() == true);
+
+    copy = moved;
+    CHECK(copy == vec);
+  }
+}
+
+// *** Storage ***
+
+TEST_CASE("Inline columns live inside the container") {
+  small_vector vec {mock_0, mock_1};
+
+  auto const* const begin = reinterpret_cast<std::byte const*>(&vec);
+  auto const* const ids   = reinterpret_cast<std::byte const*>(vec.items<0>().data());
+  CHECK(ids >= begin);
+  CHECK(ids < begin + sizeof(vec));
+}
+
+TEST_CASE("Spilling keeps every element") {
+  small_vector vec {mock_0, mock_1, mock_2};
+  vec.push_back(mock_3);
+
+  CHECK(vec.is_inline() == false);
+  CHECK(vec.capacity() >= 4U);
+  CHECK(vec.items<0>()[0] == mock_0.id);
+  CHECK(vec.items<1>()[2] == mock_2.density);
+  CHECK(vec.items<2>()[3] == mock_3.velocity);
+
+  vec.clear();
+  CHECK(vec.empty() == true);
+  CHECK(vec.is_inline() == false);
+}
+
+TEST_CASE("reserve beyond the inline capacity spills") {
+  small_vector vec {mock_0};
+
+  vec.reserve(2);
+  CHECK(vec.is_inline() == true);
+
+  vec.reserve(10);
+  CHECK(vec.is_inline() == false);
+  CHECK(vec.capacity() >= 10U);
+  CHECK(vec.items<0>()[0] == mock_0.id);
+}
+
+TEST_CASE("items returns spans over the live elements") {
+  small_vector vec {mock_0, mock_1, mock_2};
+
+  auto ids = vec.items<id_field>();
+  CHECK(ids.size() == 3U);
+  ids[1] = 42;
+  CHECK(std::get<0>(vec.at(1)) == 42);
+  CHECK(vec.spans().density[2] == mock_2.density);
+}
+
+// *** Modifiers ***
+
+TEST_CASE("push_back tuple") {
+  small_vector vec {mock_0};
+  small_vector const other {mock_1};
+  vec.push_back(*other.begin());
+  CHECK(vec == small_vector {mock_0, mock_1});
+}
+
+TEST_CASE("pop_back, resize and clear") {
+  small_vector vec {mock_0, mock_1, mock_2};
+
+  vec.pop_back();
+  CHECK(vec.size() == 2U);
+  CHECK(std::get<0>(vec.back()) == mock_1.id);
+
+  vec.resize(3);
+  CHECK(vec.size() == 3U);
+  CHECK(vec.items<1>()[2] == 0.0);
+
+  vec.clear();
+  CHECK(vec.empty() == true);
+  CHECK(vec.is_inline() == true);
+}
+
+TEST_CASE("erase") {
+  for (auto vec: {small_vector {mock_0, mock_1, mock_2}, small_vector {mock_0, mock_1, mock_2, mock_3}}) {
+    auto const size = vec.size();
+
+    vec.erase(vec.begin() + 1);
+    CHECK(vec.size() == size - 1);
+    CHECK(vec.items<0>()[0] == mock_0.id);
+    CHECK(vec.items<0>()[1] == mock_2.id);
+
+    vec.erase(vec.begin(), vec.begin() + 2);
+    CHECK(vec.size() == size - 3);
+  }
+}
+
+TEST_CASE("insert") {
+  std::vector const mocks {mock_1, mock_2};
+
+  small_vector vec {mock_0};
+  vec.insert(vec.begin(), mocks.begin(), mocks.end());
+  CHECK(vec == small_vector {mock_1, mock_2, mock_0});
+  CHECK(vec.is_inline() == true);
+
+  vec.insert(vec.begin() + 1, mocks.begin(), mocks.end());
+  CHECK(vec == small_vector {mock_1, mock_1, mock_2, mock_2, mock_0});
+  CHECK(vec.is_inline() == false);
+}
+
+TEST_CASE("dual_vector with small layout") {
+  dual_vector<Mock, layout::soa_small<2>> vec {mock_0, mock_1};
+  vec.push_back(mock_2);
+
+  CHECK(vec.size() == 3U);
+  CHECK(vec[2] == mock_2);
+  vec[0] = mock_3;
+  CHECK(vec[0] == mock_3);
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,173 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file test_soa_ring.cpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Tests for soa_ring (lock-free SoA ring buffer)
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "test_containers.hpp"
+
+#include <thread>
+#include <vector>
+
+using namespace rflect;
+
+using spsc_ring = soa_ring<Mock, 4>;
+using mpsc_ring = mpsc_soa_ring<Mock, 4>;
+
+constexpr auto density_field = std::define_static_string("density");
+
+TEST_SUITE_BEGIN("SoA Ring");
+
+// *** Producers ***
+
+TEST_CASE_TEMPLATE("try_push until full", Ring, spsc_ring, mpsc_ring) {
+  Ring ring;
+  CHECK(ring.empty() == true);
+  CHECK(Ring::capacity() == 4U);
+
+  for (auto const& mock: {mock_0, mock_1, mock_2, mock_3}) {
+    CHECK(ring.try_push(mock) == true);
+  }
+  CHECK(ring.size() == 4U);
+  CHECK(ring.try_push(mock_0) == false);
+
+  ring.release(ring.read_batch(1));
+  CHECK(ring.try_push(mock_0) == true);
+}
+
+TEST_CASE_TEMPLATE("try_push tuples and proxies", Ring, spsc_ring, mpsc_ring) {
+  dual_vector<Mock, layout::aos> const aos {mock_0};
+  dual_vector<Mock, layout::soa> const soa {mock_1};
+
+  Ring ring;
+  CHECK(ring.try_push(aos[0]) == true);
+  CHECK(ring.try_push(soa[0]) == true);
+  CHECK(ring.try_push(std::tuple {mock_2.id, mock_2.density, mock_2.velocity}) == true);
+
+  auto const batch = ring.read_batch();
+  REQUIRE(batch.size() == 3U);
+  CHECK(batch[0] == mock_0);
+  CHECK(batch[1] == mock_1);
+  CHECK(batch[2] == mock_2);
+}
+
+// *** Consumer ***
+
+TEST_CASE_TEMPLATE("read_batch exposes member columns", Ring, spsc_ring, mpsc_ring) {
+  Ring ring;
+  ring.try_push(mock_0);
+  ring.try_push(mock_1);
+  ring.try_push(mock_2);
+
+  auto const batch = ring.read_batch();
+  CHECK(batch.size() == 3U);
+
+  auto const densities = batch.template items<density_field>();
+  CHECK(densities.size() == 3U);
+  CHECK(densities[1] == mock_1.density);
+  CHECK(batch.spans().id[2] == mock_2.id);
+  CHECK(std::get<0>(batch.at(0)) == mock_0.id);
+  CHECK(batch[2].velocity() == mock_2.velocity);
+
+  std::size_t count = 0;
+  for (auto const [id, density, velocity]: batch) {
+    CHECK(id == static_cast<std::int32_t>(count++));
+  }
+  CHECK(count == 3U);
+
+  ring.release(batch);
+  CHECK(ring.empty() == true);
+  CHECK(ring.read_batch().empty() == true);
+}
+
+TEST_CASE_TEMPLATE("read_batch stops at the end of the columns", Ring, spsc_ring, mpsc_ring) {
+  Ring ring;
+  for (auto const& mock: {mock_0, mock_1, mock_2}) {
+    ring.try_push(mock);
+  }
+  ring.release(ring.read_batch(2));
+
+  ring.try_push(mock_3);
+  ring.try_push(mock_0);
+  ring.try_push(mock_1);
+
+  auto const tail = ring.read_batch();
+  REQUIRE(tail.size() == 2U);
+  CHECK(tail[0] == mock_2);
+  CHECK(tail[1] == mock_3);
+  ring.release(tail);
+
+  auto const wrapped = ring.read_batch();
+  REQUIRE(wrapped.size() == 2U);
+  CHECK(wrapped[0] == mock_0);
+  CHECK(wrapped[1] == mock_1);
+}
+
+TEST_CASE_TEMPLATE("try_pop", Ring, spsc_ring, mpsc_ring) {
+  Ring ring;
+  Mock mock {};
+  CHECK(ring.try_pop(mock) == false);
+
+  ring.try_push(mock_2);
+  CHECK(ring.try_pop(mock) == true);
+  CHECK(mock == mock_2);
+  CHECK(ring.empty() == true);
+}
+
+// *** Concurrency ***
+
+namespace {
+
+/**
+ * Pushes `count` records from every producer thread and checks the consumer sees all of them intact
+ */
+template<typename Ring>
+void stress(std::size_t const producers, std::int32_t const count) {
+  Ring ring;
+  std::vector<std::jthread> threads;
+  for (std::size_t producer = 0; producer < producers; ++producer) {
+    threads.emplace_back([&] {
+      for (std::int32_t id = 1; id <= count; ++id) {
+        while (not ring.try_push(Mock {.id = id, .density = 2.0 * id, .velocity = {}})) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  std::int64_t sum      = 0;
+  std::int64_t received = 0;
+  bool intact           = true;
+  while (received < static_cast<std::int64_t>(producers) * count) {
+    auto const batch = ring.read_batch(3);
+    for (auto const [id, density, velocity]: batch) {
+      intact = intact and density == 2.0 * id;
+      sum += id;
+    }
+    received += static_cast<std::int64_t>(batch.size());
+    ring.release(batch);
+  }
+
+  CHECK(intact == true);
+  CHECK(sum == static_cast<std::int64_t>(producers) * count * (count + 1) / 2);
+}
+
+} // namespace
+
+TEST_CASE("Single producer thread") {
+  stress<soa_ring<Mock, 16>>(1, 20000);
+}
+
+TEST_CASE("Several producer threads") {
+  stress<mpsc_soa_ring<Mock, 16>>(4, 20000);
+}
+
+TEST_SUITE_END();
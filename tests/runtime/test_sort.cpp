@@ -0,0 +1,133 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file test_sort.cpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Tests for sort_by/argsort_by (key column sort)
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "test_containers.hpp"
+
+#include <rflect/introspection/sort.hpp>
+
+#include <cstdlib>
+#include <random>
+#include <string>
+
+using namespace rflect;
+
+struct Event {
+  DEFINE_PROXY(timestamp, cell, name);
+
+  std::double_t timestamp;
+  std::int32_t cell;
+  std::string name;
+
+  friend bool operator==(Event const&, Event const&) = default;
+};
+
+std::vector<Event> make_events(std::size_t const size) {
+  std::mt19937 engine {7}; // NOLINT
+  std::uniform_real_distribution<std::double_t> time {-100.0, 100.0};
+  std::uniform_int_distribution<std::int32_t> cell {-50, 50};
+
+  std::vector<Event> events(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    events[i] = Event {.timestamp = time(engine), .cell = cell(engine), .name = std::to_string(i)};
+  }
+  return events;
+}
+
+constexpr auto name_field = std::define_static_string("name");
+
+// Names are unique, so they identify the permutation applied to the rows
+template<typename Container>
+std::vector<std::string> names_of(Container const& container) {
+  std::vector<std::string> names;
+  for (std::size_t i = 0; i < container.size(); ++i) {
+    if constexpr (requires { container.template items<name_field>(); }) {
+      names.push_back(container.template items<name_field>()[i]);
+    }
+    else if constexpr (requires { container[i].name(); }) {
+      names.push_back(container[i].name());
+    }
+    else {
+      names.push_back(container[i].name);
+    }
+  }
+  return names;
+}
+
+template<auto Member, typename Comp = std::ranges::less>
+std::vector<std::string> reference_sort(std::vector<Event> events, Comp comp = {}) {
+  std::ranges::stable_sort(events, comp, Member);
+  return names_of(events);
+}
+
+TEST_SUITE_BEGIN("Sort by");
+
+TEST_CASE("Radix keys keep their order") {
+  CHECK(detail::radix_bits(-1) < detail::radix_bits(0));
+  CHECK(detail::radix_bits(-2.5) < detail::radix_bits(-0.5));
+  CHECK(detail::radix_bits(-0.0F) == detail::radix_bits(0.0F));
+  CHECK(detail::radix_bits(1.0) < detail::radix_bits(std::numeric_limits<std::double_t>::infinity()));
+}
+
+TEST_CASE("argsort_by is stable") {
+  multi_vector<Mock> const mocks {mock_2, mock_0, mock_3, mock_1, mock_0};
+  CHECK(argsort_by<&Mock::id>(mocks) == std::vector<std::size_t> {1, 4, 3, 0, 2});
+  CHECK(argsort_by<&Mock::id>(mocks, std::ranges::greater {}) == std::vector<std::size_t> {2, 0, 3, 1, 4});
+}
+
+TEST_CASE_TEMPLATE(
+    "sort_by matches a stable sort", Container, multi_vector<Event>, dual_vector<Event, layout::soa>,
+    dual_vector<Event, layout::aos>, std::vector<Event>
+) {
+  auto const events = make_events(1000);
+  Container container;
+  for (auto const& event: events) {
+    container.push_back(event);
+  }
+
+  SUBCASE("Integral key, radix sort") {
+    sort_by<&Event::cell>(container);
+    CHECK(names_of(container) == reference_sort<&Event::cell>(events));
+  }
+
+  SUBCASE("Floating point key, descending radix sort") {
+    sort_by<&Event::timestamp>(container, std::ranges::greater {});
+    CHECK(names_of(container) == reference_sort<&Event::timestamp>(events, std::ranges::greater {}));
+  }
+
+  SUBCASE("Custom comparator, comparison sort") {
+    auto const by_magnitude = [](std::int32_t const a, std::int32_t const b) { return std::abs(a) < std::abs(b); };
+    sort_by<&Event::cell>(container, by_magnitude);
+    CHECK(names_of(container) == reference_sort<&Event::cell>(events, by_magnitude));
+  }
+}
+
+TEST_CASE("Parallel sort_by") {
+  auto const events = make_events(3 * detail::parallel_sort_grain + 17);
+  multi_vector<Event> container;
+  container.append_range(events);
+
+  SUBCASE("Radix sort") {
+    sort_by<&Event::timestamp>(execution::parallel_policy {.threads = 3}, container);
+    CHECK(names_of(container) == reference_sort<&Event::timestamp>(events));
+    CHECK(std::ranges::is_sorted(container.items<0>()));
+  }
+
+  SUBCASE("Comparison sort") {
+    auto const by_magnitude = [](std::int32_t const a, std::int32_t const b) { return std::abs(a) < std::abs(b); };
+    sort_by<&Event::cell>(execution::parallel_policy {.threads = 3}, container, by_magnitude);
+    CHECK(names_of(container) == reference_sort<&Event::cell>(events, by_magnitude));
+  }
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,150 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file test_split_vector.cpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Tests for split_vector/split_array (hot SoA columns, cold AoS side array)
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "test_containers.hpp"
+
+using namespace rflect;
+
+constexpr auto id_field      = std::define_static_string("id");
+constexpr auto density_field = std::define_static_string("density");
+
+using hot_density = layout::split<&Mock::density>;
+using vector_type = split_vector<Mock, std::allocator, &Mock::density>;
+
+TEST_SUITE_BEGIN("Split Vector");
+
+// *** Constructors ***
+
+TEST_CASE("Default constructor") {
+  vector_type vec;
+  CHECK(vec.size() == 0U);
+  CHECK(vec.empty() == true);
+}
+
+TEST_CASE("Initializer list constructor") {
+  vector_type vec {mock_0, mock_1, mock_2};
+  CHECK(vec.size() == 3U);
+  CHECK(vec.at(0) == mock_0);
+  CHECK(vec.at(2) == mock_2);
+}
+
+TEST_CASE("Explicit size constructor") {
+  vector_type vec(4);
+  CHECK(vec.size() == 4U);
+  CHECK(vec.hot().size() == 4U);
+  CHECK(vec.cold().size() == 4U);
+}
+
+// *** Storage ***
+
+TEST_CASE("Hot members are columns, cold members stay together") {
+  vector_type vec {mock_0, mock_1, mock_2};
+
+  auto densities = vec.items<density_field>();
+  CHECK(densities.size() == 3U);
+  CHECK(densities[1] == mock_1.density);
+
+  auto cold = vec.cold();
+  CHECK(cold[2].id == mock_2.id);
+  CHECK(cold[2].velocity == mock_2.velocity);
+  CHECK(sizeof(cold[0]) < sizeof(Mock));
+}
+
+TEST_CASE("item<name> addresses either side") {
+  vector_type vec {mock_0, mock_1, mock_2};
+
+  vec.item<id_field>(2)      = 42;
+  vec.item<density_field>(1) = -1.0;
+
+  CHECK(vec.at(2).id == 42);
+  CHECK(vec.at(1).density == -1.0);
+  CHECK(vec.at(0) == mock_0);
+}
+
+// *** Modifiers ***
+
+TEST_CASE("push_back and pop_back keep both sides in step") {
+  vector_type vec;
+  vec.push_back(mock_0);
+  vec.push_back(mock_1);
+  CHECK(vec.back() == mock_1);
+
+  vec.pop_back();
+  CHECK(vec.size() == 1U);
+  CHECK(vec.hot().size() == 1U);
+  CHECK(vec.back() == mock_0);
+}
+
+TEST_CASE("erase") {
+  vector_type vec {mock_0, mock_1, mock_2, mock_3};
+
+  vec.erase(vec.begin() + 1);
+  CHECK(vec == vector_type {mock_0, mock_2, mock_3});
+
+  vec.erase(vec.begin(), vec.begin() + 2);
+  CHECK(vec == vector_type {mock_3});
+}
+
+TEST_CASE("append_range and insert") {
+  std::vector const mocks {mock_1, mock_2};
+  vector_type vec {mock_0, mock_3};
+
+  vec.insert(vec.begin() + 1, mocks.begin(), mocks.end());
+  CHECK(vec == vector_type {mock_0, mock_1, mock_2, mock_3});
+
+  vec.append_range(mocks);
+  CHECK(vec.size() == 6U);
+  CHECK(vec.at(5) == mock_2);
+}
+
+TEST_CASE("reserve and resize") {
+  vector_type vec {mock_0};
+
+  vec.reserve(10);
+  CHECK(vec.capacity() >= 10U);
+
+  vec.resize(3);
+  CHECK(vec.size() == 3U);
+  CHECK(vec.at(0) == mock_0);
+  CHECK(vec.at(2).density == 0.0);
+}
+
+// *** dual_vector / dual_array ***
+
+TEST_CASE("dual_vector proxies route members to their side") {
+  dual_vector<Mock, hot_density> vec {mock_0, mock_1, mock_2};
+
+  vec[1].density() = -1.0;
+  vec[2].id()      = 42;
+  CHECK(vec.items<density_field>()[1] == -1.0);
+  CHECK(vec[2].id() == 42);
+
+  vec[0] = mock_3;
+  CHECK(vec[0] == mock_3);
+
+  for (std::int32_t i = 0; auto mock: vec) {
+    mock.id() = i++;
+  }
+  CHECK(vec.back().id() == 2);
+}
+
+TEST_CASE("dual_array with split layout") {
+  dual_array<Mock, 4, hot_density> arr {mock_0, mock_1, mock_2, mock_3};
+
+  CHECK(arr[3] == mock_3);
+  arr[0].density() = 2.0;
+  CHECK(arr.items<density_field>()[0] == 2.0);
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,147 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file test_static_multi_vector.cpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Tests for static_multi_vector (fixed capacity SoA storage)
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "test_containers.hpp"
+
+#include <new>
+#include <vector>
+
+using namespace rflect;
+
+using static_vector = static_multi_vector<Mock, 3>;
+
+constexpr auto id_field = std::define_static_string("id");
+
+TEST_SUITE_BEGIN("Static Multi Vector");
+
+// *** Constructors ***
+
+TEST_CASE("Default constructor") {
+  static_vector vec;
+  CHECK(vec.size() == 0U);
+  CHECK(vec.empty() == true);
+  CHECK(static_vector::capacity() == 3U);
+}
+
+TEST_CASE("Initializer list constructor") {
+  static_vector vec {mock_0, mock_1, mock_2};
+  CHECK(vec.size() == 3U);
+  CHECK(std::get<0>(vec.at(0)) == mock_0.id);
+  CHECK(std::get<1>(vec.at(2)) == mock_2.density);
+
+  CHECK_THROWS_AS(static_vector({mock_0, mock_1, mock_2, mock_3}), std::bad_alloc);
+}
+
+TEST_CASE("Explicit size constructor") {
+  static_vector vec(2);
+  CHECK(vec.size() == 2U);
+  CHECK(vec.items<0>()[1] == 0);
+
+  CHECK_THROWS_AS(static_vector(4), std::bad_alloc);
+}
+
+TEST_CASE("Columns live inside the container") {
+  static_vector vec {mock_0, mock_1};
+
+  auto const* const begin = reinterpret_cast<std::byte const*>(&vec);
+  auto const* const ids   = reinterpret_cast<std::byte const*>(vec.items<0>().data());
+  CHECK(ids >= begin);
+  CHECK(ids < begin + sizeof(vec));
+}
+
+TEST_CASE("constexpr") {
+  static constexpr auto vec = [] {
+    static_vector vec {mock_0, mock_1};
+    vec.push_back(mock_2);
+    vec.erase(vec.begin());
+    vec.pop_back();
+    vec.push_back(mock_3);
+    return vec;
+  }();
+  static_assert(vec.size() == 2U);
+  static_assert(std::get<0>(vec.at(0)) == mock_1.id);
+  static_assert(std::get<0>(vec.at(1)) == mock_3.id);
+}
+
+// *** Element access ***
+
+TEST_CASE("items returns spans over the live elements") {
+  static_vector vec {mock_0, mock_1};
+
+  auto ids = vec.items<id_field>();
+  CHECK(ids.size() == 2U);
+  ids[1] = 42;
+  CHECK(std::get<0>(vec.at(1)) == 42);
+  CHECK(vec.spans().density[0] == mock_0.density);
+  CHECK(vec.spans().density.size() == 2U);
+}
+
+// *** Modifiers ***
+
+TEST_CASE("push_back past the capacity") {
+  static_vector vec {mock_0, mock_1, mock_2};
+
+  CHECK_THROWS_AS(vec.push_back(mock_3), std::bad_alloc);
+  CHECK(vec.try_push_back(mock_3) == false);
+  CHECK(vec.size() == 3U);
+
+  vec.pop_back();
+  CHECK(vec.try_push_back(mock_3) == true);
+  CHECK(std::get<0>(vec.back()) == mock_3.id);
+}
+
+TEST_CASE("push_back tuple") {
+  static_vector vec {mock_0};
+  static_vector const other {mock_1};
+  vec.push_back(*other.begin());
+  CHECK(vec == static_vector {mock_0, mock_1});
+}
+
+TEST_CASE("pop_back, resize and clear") {
+  static_vector vec {mock_0, mock_1, mock_2};
+
+  vec.pop_back();
+  CHECK(vec.size() == 2U);
+  CHECK(std::get<0>(vec.back()) == mock_1.id);
+
+  vec.resize(3);
+  CHECK(vec.items<1>()[2] == 0.0);
+  CHECK_THROWS_AS(vec.resize(4), std::bad_alloc);
+
+  vec.clear();
+  CHECK(vec.empty() == true);
+}
+
+TEST_CASE("erase") {
+  static_vector vec {mock_0, mock_1, mock_2};
+
+  vec.erase(vec.begin() + 1);
+  CHECK(vec == static_vector {mock_0, mock_2});
+
+  vec.erase(vec.begin(), vec.end());
+  CHECK(vec.empty() == true);
+}
+
+TEST_CASE("append_range and insert") {
+  std::vector const mocks {mock_1, mock_2};
+
+  static_vector vec {mock_0};
+  vec.insert(vec.begin(), mocks.begin(), mocks.end());
+  CHECK(vec == static_vector {mock_1, mock_2, mock_0});
+
+  CHECK_THROWS_AS(vec.append_range(mocks), std::bad_alloc);
+  CHECK(vec == static_vector {mock_1, mock_2, mock_0});
+}
+
+TEST_SUITE_END();
@@ -0,0 +1,116 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file test_tiled_vector.cpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Tests for tiled_vector (AoSoA storage)
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "test_containers.hpp"
+
+using namespace rflect;
+
+constexpr auto id_field      = std::define_static_string("id");
+constexpr auto density_field = std::define_static_string("density");
+
+TEST_SUITE_BEGIN("Tiled Vector");
+
+// *** Constructors ***
+
+TEST_CASE("Default constructor") {
+  tiled_vector<Mock, 2> vec;
+  CHECK(vec.size() == 0U);
+  CHECK(vec.empty() == true);
+  CHECK(vec.tiles().size() == 0U);
+}
+
+TEST_CASE("Initializer list constructor") {
+  tiled_vector<Mock, 2> vec {mock_0, mock_1, mock_2};
+  CHECK(vec.size() == 3U);
+  CHECK(vec.tiles().size() == 2U);
+}
+
+TEST_CASE("Explicit size constructor") {
+  tiled_vector<Mock, 4> vec(5);
+  CHECK(vec.size() == 5U);
+  CHECK(vec.tiles().size() == 2U);
+}
+
+// *** Tile layout ***
+
+TEST_CASE("Elements are laid out lane by lane") {
+  tiled_vector<Mock, 2> vec {mock_0, mock_1, mock_2, mock_3};
+
+  auto tiles = vec.tiles();
+  CHECK(tiles[0].id[0] == mock_0.id);
+  CHECK(tiles[0].id[1] == mock_1.id);
+  CHECK(tiles[1].id[0] == mock_2.id);
+  CHECK(tiles[1].id[1] == mock_3.id);
+  CHECK(tiles[1].density[1] == mock_3.density);
+}
+
+TEST_CASE("item<name> addresses a single lane") {
+  tiled_vector<Mock, 2> vec {mock_0, mock_1, mock_2};
+
+  vec.item<id_field>(2)      = 42;
+  vec.item<density_field>(1) = -1.0;
+
+  CHECK(vec.at(2).id == 42);
+  CHECK(vec.at(1).density == -1.0);
+  CHECK(vec.at(0) == mock_0);
+}
+
+// *** Modifiers ***
+
+TEST_CASE("push_back allocates one tile per Lanes elements") {
+  tiled_vector<Mock, 2> vec;
+
+  vec.push_back(mock_0);
+  CHECK(vec.tiles().size() == 1U);
+  vec.push_back(mock_1);
+  CHECK(vec.tiles().size() == 1U);
+  vec.push_back(mock_2);
+  CHECK(vec.tiles().size() == 2U);
+  CHECK(vec.capacity() >= 4U);
+
+  CHECK(vec.at(0) == mock_0);
+  CHECK(vec.at(1) == mock_1);
+  CHECK(vec.at(2) == mock_2);
+}
+
+TEST_CASE("pop_back releases empty tiles") {
+  tiled_vector<Mock, 2> vec {mock_0, mock_1, mock_2};
+
+  vec.pop_back();
+  CHECK(vec.size() == 2U);
+  CHECK(vec.tiles().size() == 1U);
+  CHECK(vec.back() == mock_1);
+}
+
+TEST_CASE("erase shifts elements across tiles") {
+  tiled_vector<Mock, 2> vec {mock_0, mock_1, mock_2, mock_3};
+  tiled_vector<Mock, 2> expected {mock_0, mock_2, mock_3};
+
+  vec.erase(vec.begin() + 1);
+
+  CHECK(vec.size() == 3U);
+  CHECK(vec == expected);
+}
+
+TEST_CASE("erase range") {
+  tiled_vector<Mock, 2> vec {mock_0, mock_1, mock_2, mock_3};
+  tiled_vector<Mock, 2> expected {mock_0, mock_3};
+
+  vec.erase(vec.begin() + 1, vec.begin() + 3);
+
+  CHECK(vec == expected);
+  CHECK(vec.tiles().size() == 1U);
+}
+
+TEST_SUITE_END();
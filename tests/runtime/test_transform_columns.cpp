@@ -0,0 +1,98 @@
+/************************************************************************
+ * Copyright (c) 2025 Alvaro Cabrera Barrio
+ * This code is licensed under MIT license (see LICENSE.txt for details)
+ ************************************************************************/
+/**
+ * @file test_transform_columns.cpp
+ * @version 1.0
+ * @date 17/10/2026
+ * @brief Tests for the column wise SIMD kernels
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include "test_containers.hpp"
+
+#include <rflect/introspection/transform_columns.hpp>
+
+using namespace rflect;
+
+struct Complex {
+  DEFINE_PROXY(real, imag);
+
+  float real;
+  float imag;
+};
+
+constexpr auto real_field = std::define_static_string("real");
+constexpr auto imag_field = std::define_static_string("imag");
+
+TEST_SUITE_BEGIN("Transform columns");
+
+TEST_CASE("transform_spans handles full batches and the remainder") {
+  std::vector<float> x(37, 2.0F);
+  std::vector<float> const y(37, 3.0F);
+
+  transform_spans([](auto& a, auto const& b) { a *= b; }, std::span(x), std::span(y));
+
+  CHECK(std::ranges::all_of(x, [](float const value) { return value == 6.0F; }));
+}
+
+TEST_CASE("transform_spans stops at the shortest column") {
+  std::vector<double> x(20, 1.0);
+  std::vector<double> const y(5, 4.0);
+
+  transform_spans([](auto& a, auto const& b) { a += b; }, std::span(x), std::span(y));
+
+  CHECK(x[4] == 5.0);
+  CHECK(x[5] == 1.0);
+}
+
+TEST_CASE("transform_columns selects members of a multi_vector") {
+  multi_vector<Complex> numbers;
+  for (int i = 0; i < 19; ++i) {
+    numbers.push_back(Complex {.real = static_cast<float>(i), .imag = 2.0F});
+  }
+
+  transform_columns<&Complex::imag, &Complex::real>(numbers, [](auto& imag, auto const& real) { imag *= real; });
+
+  CHECK(numbers.items<1>()[0] == 0.0F);
+  CHECK(numbers.items<1>()[18] == 36.0F);
+  CHECK(numbers.items<0>()[18] == 18.0F);
+}
+
+TEST_CASE_TEMPLATE("transform_columns over SoA dual_vector", T, layout::soa, layout::packed_soa) {
+  dual_vector<Mock, T> mocks {mock_0, mock_1, mock_2, mock_3};
+
+  transform_columns<&Mock::density>(mocks, [](auto& density) { density *= 2.0; });
+
+  CHECK(mocks.at(0).density() == mock_0.density * 2.0);
+  CHECK(mocks.at(3).density() == mock_3.density * 2.0);
+}
+
+TEST_CASE_TEMPLATE("transform_columns over aligned columns", T, multi_vector<Complex, std::allocator, 64>,
+                   dual_vector<Complex, layout::aligned_soa<64>>) {
+  T numbers;
+  for (int i = 0; i < 19; ++i) {
+    numbers.push_back(Complex {.real = static_cast<float>(i), .imag = 2.0F});
+  }
+
+  transform_columns<&Complex::imag, &Complex::real>(numbers, [](auto& imag, auto const& real) { imag *= real; });
+
+  auto const& imag = numbers.template items<imag_field>();
+  CHECK(numbers.size() == 19U);
+  CHECK(imag[0] == 0.0F);
+  CHECK(imag[18] == 36.0F);
+  CHECK(numbers.template items<real_field>()[18] == 18.0F);
+}
+
+TEST_CASE("transform_columns with non arithmetic members") {
+  multi_vector<Mock> mocks {mock_0, mock_1};
+
+  transform_columns<&Mock::velocity>(mocks, [](auto& velocity) { velocity[0] = -1.0; });
+
+  CHECK(mocks.items<2>()[1][0] == -1.0);
+}
+
+TEST_SUITE_END();
@@ -26,6 +26,13 @@ static_assert(std::same_as<decltype(mock_vector.id), std::vector<decltype(Mock{}
 static_assert(std::same_as<decltype(mock_vector.density), std::vector<decltype(Mock{}.density)>>);
 static_assert(std::same_as<decltype(mock_vector.velocity), std::vector<decltype(Mock{}.velocity)>>);
 
+// Aligned struct of vector conversion asserts (Mock)
+using aligned_mock_vector = rflect::struct_of_vectors<Mock, std::allocator, 64>;
+using aligned_density     = rflect::aligned_allocator<decltype(Mock{}.density), std::allocator, 64>;
+static_assert(
+    std::same_as<decltype(aligned_mock_vector{}.density), std::vector<decltype(Mock{}.density), aligned_density>>
+);
+
 // Struct of array conversion asserts (BiggerMock)
 static_assert(std::same_as<decltype(big_mock_array.id), std::array<decltype(BiggerMock{}.id), 50>>);
 static_assert(std::same_as<decltype(big_mock_array.density), std::array<decltype(BiggerMock{}.density), 50>>);
@@ -40,6 +47,52 @@ static_assert(std::same_as<decltype(big_mock_vector.velocity), std::vector<declt
 static_assert(std::same_as<decltype(big_mock_vector.positions), std::vector<decltype(BiggerMock{}.positions)>>);
 static_assert(std::same_as<decltype(big_mock_vector.friends), std::vector<decltype(BiggerMock{}.friends)>>);
 
+// Struct of span conversion asserts (Mock)
+static_assert(std::same_as<decltype(rflect::struct_of_spans<Mock>{}.id), std::span<decltype(Mock{}.id)>>);
+static_assert(std::same_as<decltype(rflect::struct_of_spans<Mock>{}.density), std::span<decltype(Mock{}.density)>>);
+static_assert(std::same_as<decltype(rflect::struct_of_spans<Mock const>{}.id), std::span<decltype(Mock{}.id) const>>);
+
+// Struct of pointer conversion asserts (Mock)
+static_assert(std::same_as<decltype(rflect::struct_of_pointers<Mock>{}.id), decltype(Mock{}.id)*>);
+static_assert(std::same_as<decltype(rflect::struct_of_pointers<Mock>{}.velocity), decltype(Mock{}.velocity)*>);
+
+// Member subset asserts (Mock)
+using mock_hot  = rflect::struct_with<Mock, &Mock::velocity, &Mock::id>;
+using mock_cold = rflect::struct_without<Mock, &Mock::velocity, &Mock::id>;
+static_assert(std::same_as<decltype(mock_hot{}.id), decltype(Mock{}.id)>);
+static_assert(std::same_as<decltype(mock_hot{}.velocity), decltype(Mock{}.velocity)>);
+static_assert(std::same_as<decltype(mock_cold{}.density), decltype(Mock{}.density)>);
+static_assert(sizeof(mock_cold) == sizeof(Mock{}.density));
+static_assert(identifier_of(rflect::nonstatic_data_member<mock_hot>(0)) == "id");
+
+// Flattening asserts
+struct Point {
+  std::double_t x, y, z;
+};
+
+struct Frame {
+  Point origin;
+  std::double_t scale;
+};
+
+struct Body {
+  std::int32_t id;
+  Point position;
+  Frame frame;
+  std::array<std::double_t, 3> velocity;
+};
+
+using flat_body = rflect::flat_struct<Body>;
+static_assert(std::same_as<decltype(flat_body{}.id), std::int32_t>);
+static_assert(std::same_as<decltype(flat_body{}.position_x), std::double_t>);
+static_assert(std::same_as<decltype(flat_body{}.frame_origin_z), std::double_t>);
+static_assert(std::same_as<decltype(flat_body{}.frame_scale), std::double_t>);
+static_assert(std::same_as<decltype(flat_body{}.velocity), std::array<std::double_t, 3>>); // Arrays are kept
+static_assert(identifier_of(rflect::nonstatic_data_member<flat_body>(1)) == "position_x");
+static_assert(std::same_as<decltype(rflect::flat_struct_of_vectors<Body>{}.position_y), std::vector<std::double_t>>);
+constexpr Body body {.id = 1, .position = {}, .frame = {.origin = {.y = 2.0}}, .velocity = {}};
+static_assert(rflect::unflatten<Body>(rflect::flatten(body)).frame.origin.y == 2.0);
+
 // TODO asserts for custom allocator types
 
 } // namespace
@@ -20,13 +20,75 @@ constexpr std::string_view range_error =  "Range_error not satisfied";
 
 static_assert(std::forward_iterator<rflect::proxy_iterator<mock_proxy_vec>>, iterator_error);
 static_assert(std::forward_iterator<rflect::proxy_iterator<bigger_mock_proxy_vec>>, iterator_error);
+static_assert(std::random_access_iterator<rflect::proxy_iterator<mock_proxy_vec>>, iterator_error);
+static_assert(std::random_access_iterator<rflect::proxy_iterator<mock_proxy_const_vec>>, iterator_error);
+static_assert(std::same_as<std::iter_value_t<rflect::proxy_iterator<mock_proxy_vec>>, Mock>);
+static_assert(std::same_as<std::iter_rvalue_reference_t<rflect::proxy_iterator<mock_proxy_vec>>, Mock>);
+static_assert(std::permutable<rflect::proxy_iterator<mock_proxy_vec>>, iterator_error);
+static_assert(
+    std::sortable<
+        rflect::dual_vector<Mock, rflect::layout::soa>::iterator, std::ranges::less,
+        decltype([](Mock const& mock) { return mock.id; })>,
+    iterator_error
+);
+static_assert(std::ranges::random_access_range<rflect::dual_vector<Mock>>, range_error);
+static_assert(std::ranges::random_access_range<rflect::dual_vector<Mock, rflect::layout::soa>>, range_error);
+static_assert(std::ranges::sized_range<rflect::dual_vector<Mock, rflect::layout::soa>>, range_error);
 static_assert(std::ranges::range<rflect::dual_vector<Mock>>, range_error);
 static_assert(std::ranges::range<rflect::dual_vector<BiggerMock>>, range_error);
 
+static_assert(std::same_as<decltype(std::declval<rflect::dual_vector<Mock> const&>().empty()), bool>);
+static_assert(std::same_as<decltype(std::declval<rflect::dual_array<Mock, 4> const&>().empty()), bool>);
+
 static_assert(not std::is_const_v<rflect::dual_vector<Mock>::view_type::underlying_container>);
 static_assert(std::is_const_v<rflect::dual_vector<Mock>::const_view_type::underlying_container>);
 
 static_assert(not std::is_const_v<rflect::dual_vector<Mock>::iterator::container>);
 static_assert(std::is_const_v<rflect::dual_vector<Mock>::const_iterator::container>);
 
+static_assert(rflect::memory_layout<rflect::layout::aosoa<8>>);
+static_assert(rflect::aosoa_layout<rflect::dual_vector<Mock, rflect::layout::aosoa<8>>>);
+static_assert(not rflect::soa_layout<rflect::dual_vector<Mock, rflect::layout::aosoa<8>>>);
+static_assert(not rflect::aos_layout<rflect::dual_vector<Mock, rflect::layout::aosoa<8>>>);
+static_assert(std::random_access_iterator<rflect::tiled_vector<Mock, 8>::iterator>, iterator_error);
+static_assert(std::random_access_iterator<rflect::tiled_vector<Mock, 8>::const_iterator>, iterator_error);
+static_assert(std::ranges::range<rflect::dual_vector<Mock, rflect::layout::aosoa<8>>>, range_error);
+
+static_assert(rflect::memory_layout<rflect::layout::packed_soa>);
+static_assert(rflect::soa_layout<rflect::dual_vector<Mock, rflect::layout::packed_soa>>);
+static_assert(not rflect::aos_layout<rflect::dual_vector<Mock, rflect::layout::packed_soa>>);
+static_assert(std::ranges::random_access_range<rflect::packed_multi_vector<Mock>>, range_error);
+static_assert(std::ranges::range<rflect::dual_vector<Mock, rflect::layout::packed_soa>>, range_error);
+
+using aligned_mock = rflect::layout::aligned_soa<64>;
+static_assert(rflect::memory_layout<aligned_mock>);
+static_assert(rflect::soa_layout<rflect::dual_vector<Mock, aligned_mock>>);
+static_assert(not rflect::aos_layout<rflect::dual_vector<Mock, aligned_mock>>);
+static_assert(std::ranges::random_access_range<rflect::multi_vector<Mock, std::allocator, 64>>, range_error);
+static_assert(std::ranges::range<rflect::dual_vector<Mock, aligned_mock>>, range_error);
+
+using small_mock = rflect::layout::soa_small<4>;
+static_assert(rflect::memory_layout<small_mock>);
+static_assert(rflect::soa_layout<rflect::dual_vector<Mock, small_mock>>);
+static_assert(std::ranges::random_access_range<rflect::small_multi_vector<Mock, 4>>, range_error);
+static_assert(std::ranges::range<rflect::dual_vector<Mock, small_mock>>, range_error);
+static_assert(std::ranges::random_access_range<rflect::static_multi_vector<Mock, 4>>, range_error);
+
+static_assert(rflect::memory_layout<rflect::layout::soa_flat>);
+static_assert(rflect::soa_layout<rflect::dual_vector<Mock, rflect::layout::soa_flat>>);
+static_assert(std::ranges::random_access_range<rflect::flat_multi_vector<Mock>>, range_error);
+static_assert(std::ranges::range<rflect::dual_vector<Mock, rflect::layout::soa_flat>>, range_error);
+
+using split_mock        = rflect::layout::split<&Mock::density, &Mock::velocity>;
+using split_mock_vector = rflect::split_vector<Mock, std::allocator, &Mock::density>;
+static_assert(rflect::memory_layout<split_mock>);
+static_assert(rflect::split_layout<rflect::dual_vector<Mock, split_mock>>);
+static_assert(rflect::gather_layout<rflect::dual_vector<Mock, split_mock>>);
+static_assert(not rflect::soa_layout<rflect::dual_vector<Mock, split_mock>>);
+static_assert(not rflect::aosoa_layout<rflect::dual_vector<Mock, split_mock>>);
+static_assert(std::random_access_iterator<split_mock_vector::iterator>, iterator_error);
+static_assert(std::random_access_iterator<split_mock_vector::const_iterator>, iterator_error);
+static_assert(std::ranges::random_access_range<split_mock_vector>, range_error);
+static_assert(std::ranges::range<rflect::dual_vector<Mock, split_mock>>, range_error);
+
 }
\ No newline at end of file